@@ -6,6 +6,8 @@
 #include <string.h>
 #include <ctype.h>
 
+#include "WStringView.h"
+
 // Forward declaration for __FlashStringHelper (for compatibility)
 class __FlashStringHelper;
 #define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
@@ -13,6 +15,9 @@ class __FlashStringHelper;
 // An inherited class for holding the result of a concatenation
 class StringSumHelper;
 
+// Accumulates many pieces into a single allocation (declared below)
+class StringBuilder;
+
 // The string class - Arduino-compatible String implementation
 class String
 {
@@ -26,6 +31,8 @@ public:
 	String(const char *cstr = "");
 	String(const String &str);
 	String(const __FlashStringHelper *str);
+	String(String &&rval);
+	explicit String(StringView view);
 	explicit String(char c);
 	explicit String(unsigned char, unsigned char base=10);
 	explicit String(int, unsigned char base=10);
@@ -37,6 +44,8 @@ public:
 	~String(void);
 
 	// memory management
+	// reserve() allocates exactly the requested size; appends grow the
+	// buffer geometrically (see grow()) so repeated += stays amortized O(1)
 	unsigned char reserve(unsigned int size);
 	inline unsigned int length(void) const {return len;}
 
@@ -44,10 +53,13 @@ public:
 	String & operator = (const String &rhs);
 	String & operator = (const char *cstr);
 	String & operator = (const __FlashStringHelper *str);
+	String & operator = (String &&rval);
 
 	// concatenate (works w/ built-in types)
 	unsigned char concat(const String &str);
 	unsigned char concat(const char *cstr);
+	unsigned char concat(const char *cstr, unsigned int length);
+	unsigned char concat(StringView view) {return concat(view.data(), view.length());}
 	unsigned char concat(char c);
 	unsigned char concat(unsigned char c);
 	unsigned char concat(int num);
@@ -60,6 +72,7 @@ public:
 
 	String & operator += (const String &rhs)	{concat(rhs); return (*this);}
 	String & operator += (const char *cstr)		{concat(cstr); return (*this);}
+	String & operator += (StringView view)		{concat(view); return (*this);}
 	String & operator += (char c)			{concat(c); return (*this);}
 	String & operator += (unsigned char num)		{concat(num); return (*this);}
 	String & operator += (int num)			{concat(num); return (*this);}
@@ -70,6 +83,8 @@ public:
 	String & operator += (double num)		{concat(num); return (*this);}
 	String & operator += (const __FlashStringHelper *str){concat(str); return (*this);}
 
+	friend class StringBuilder;
+
 	friend StringSumHelper & operator + (const StringSumHelper &lhs, const String &rhs);
 	friend StringSumHelper & operator + (const StringSumHelper &lhs, const char *cstr);
 	friend StringSumHelper & operator + (const StringSumHelper &lhs, char c);
@@ -87,18 +102,28 @@ public:
 	int compareTo(const String &s) const;
 	unsigned char equals(const String &s) const;
 	unsigned char equals(const char *cstr) const;
+	unsigned char equals(StringView view) const {return view.equals(*this);}
 	unsigned char operator == (const String &rhs) const {return equals(rhs);}
 	unsigned char operator == (const char *cstr) const {return equals(cstr);}
 	unsigned char operator != (const String &rhs) const {return !equals(rhs);}
 	unsigned char operator != (const char *cstr) const {return !equals(cstr);}
+	unsigned char operator == (StringView view) const {return equals(view);}
+	unsigned char operator != (StringView view) const {return !equals(view);}
 	unsigned char operator <  (const String &rhs) const;
 	unsigned char operator >  (const String &rhs) const;
 	unsigned char operator <= (const String &rhs) const;
 	unsigned char operator >= (const String &rhs) const;
 	unsigned char equalsIgnoreCase(const String &s) const;
-	unsigned char startsWith( const String &prefix) const;
-	unsigned char startsWith(const String &prefix, unsigned int offset) const;
-	unsigned char endsWith(const String &suffix) const;
+	unsigned char startsWith(StringView prefix) const;
+	unsigned char startsWith(StringView prefix, unsigned int offset) const;
+	unsigned char endsWith(StringView suffix) const;
+
+	// Free, non-owning view of the current contents. It is invalidated by
+	// anything that reallocates or modifies this String.
+	operator StringView() const { return StringView(buffer, len); }
+	StringView view(void) const { return StringView(buffer, len); }
+	StringView view(unsigned int beginIndex, unsigned int endIndex) const
+		{ return view().substring(beginIndex, endIndex); }
 
 	// character access
 	char charAt(unsigned int index) const;
@@ -118,18 +143,20 @@ public:
 	// search
 	int indexOf( char ch ) const;
 	int indexOf( char ch, unsigned int fromIndex ) const;
-	int indexOf( const String &str ) const;
-	int indexOf( const String &str, unsigned int fromIndex ) const;
+	int indexOf( StringView str ) const;
+	int indexOf( StringView str, unsigned int fromIndex ) const;
 	int lastIndexOf( char ch ) const;
 	int lastIndexOf( char ch, unsigned int fromIndex ) const;
-	int lastIndexOf( const String &str ) const;
-	int lastIndexOf( const String &str, unsigned int fromIndex ) const;
+	int lastIndexOf( StringView str ) const;
+	int lastIndexOf( StringView str, unsigned int fromIndex ) const;
+	// substring() allocates a copy; use view(begin, end) to slice for free
 	String substring( unsigned int beginIndex ) const { return substring(beginIndex, len); };
 	String substring( unsigned int beginIndex, unsigned int endIndex ) const;
 
 	// modification
 	void replace(char find, char replace);
-	void replace(const String& find, const String& replace);
+	// Non-overlapping, left to right; the buffer is resized at most once
+	void replace(StringView find, StringView replace);
 	void remove(unsigned int index);
 	void remove(unsigned int index, unsigned int count);
 	void toLowerCase(void);
@@ -153,6 +180,12 @@ public:
 	long toInt(void) const;
 	float toFloat(void) const;
 	double toDouble(void) const;
+	// Strict variants with explicit status, e.g. for fields from a UART:
+	//   long v; if (field.parse(v) != NUM_PARSE_OK) reject();
+	NumParseStatus parse(long &value) const { return view().parse(value); }
+	NumParseStatus parse(unsigned long &value) const { return view().parse(value); }
+	NumParseStatus parse(float &value) const { return view().parse(value); }
+	NumParseStatus parse(double &value) const { return view().parse(value); }
 
 protected:
 	char *buffer;	        // the actual char array
@@ -163,10 +196,11 @@ protected:
 	void init(void);
 	void invalidate(void);
 	unsigned char changeBuffer(unsigned int maxStrLen);
-	unsigned char concat(const char *cstr, unsigned int length);
+	unsigned char grow(unsigned int minCapacity);
 	// copy and move
 	String & copy(const char *cstr, unsigned int length);
 	String & copy(const __FlashStringHelper *pstr, unsigned int length);
+	void move(String &rhs);
 };
 
 class StringSumHelper : public String
@@ -184,6 +218,66 @@ public:
 	StringSumHelper(double num) : String(num) {}
 };
 
+// Builds a string from many pieces without reallocating on every append.
+// Either size it up front (constructor argument or reserve()) or let the
+// geometric growth policy of String handle it; toString() then hands the
+// buffer over without copying.
+class StringBuilder
+{
+public:
+	explicit StringBuilder(unsigned int expectedLength = 0) {
+		if (expectedLength) str.reserve(expectedLength);
+	}
+
+	unsigned char reserve(unsigned int size) { return str.reserve(size); }
+	unsigned int length(void) const { return str.len; }
+	const char* c_str() const { return str.c_str(); }
+
+	// Empties the builder but keeps the allocation for reuse
+	void clear(void) {
+		str.len = 0;
+		if (str.buffer) str.buffer[0] = 0;
+	}
+
+	StringBuilder & append(const char *cstr, unsigned int length) { str.concat(cstr, length); return *this; }
+	StringBuilder & append(const char *cstr) { str.concat(cstr); return *this; }
+	StringBuilder & append(const String &s) { str.concat(s); return *this; }
+	StringBuilder & append(char c) { str.concat(c); return *this; }
+	StringBuilder & append(unsigned char num) { str.concat(num); return *this; }
+	StringBuilder & append(int num) { str.concat(num); return *this; }
+	StringBuilder & append(unsigned int num) { str.concat(num); return *this; }
+	StringBuilder & append(long num) { str.concat(num); return *this; }
+	StringBuilder & append(unsigned long num) { str.concat(num); return *this; }
+	StringBuilder & append(float num) { str.concat(num); return *this; }
+	StringBuilder & append(double num) { str.concat(num); return *this; }
+
+	template <typename T>
+	StringBuilder & operator << (const T &value) { return append(value); }
+
+	// Appends several string pieces with a single allocation: the lengths
+	// are summed first, the buffer is grown once, then every piece is copied
+	template <typename... Pieces>
+	StringBuilder & appendAll(const Pieces &... pieces) {
+		str.grow(str.len + (0u + ... + pieceLength(pieces)));
+		(append(pieces), ...);
+		return *this;
+	}
+
+	// Moves the accumulated text out; the builder is left empty
+	String toString(void) {
+		String out;
+		out.move(str);
+		return out;
+	}
+
+private:
+	static unsigned int pieceLength(const char *cstr) { return cstr ? strlen(cstr) : 0; }
+	static unsigned int pieceLength(const String &s) { return s.length(); }
+	static unsigned int pieceLength(char) { return 1; }
+
+	String str;
+};
+
 // Non-member operator+ for String concatenation
 inline String operator+(const String& lhs, const String& rhs) {
 	String result(lhs);
@@ -0,0 +1,77 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include <string.h>
+
+#include "num_parse.h"
+
+class String;
+
+// Non-owning, read-only view of a run of characters (pointer + length).
+// A view never allocates: substring(), split() and trim() return new views
+// into the same storage, so the referenced text must outlive the view.
+// The text is not NUL-terminated in general - use length(), not strlen().
+class StringView
+{
+public:
+	StringView() : ptr(NULL), len(0) {}
+	StringView(const char *cstr) : ptr(cstr), len(cstr ? strlen(cstr) : 0) {}
+	StringView(const char *data, unsigned int length) : ptr(data), len(data ? length : 0) {}
+
+	const char* data() const { return ptr; }
+	unsigned int length(void) const { return len; }
+	bool isEmpty(void) const { return len == 0; }
+
+	char charAt(unsigned int index) const { return index < len ? ptr[index] : 0; }
+	char operator [] (unsigned int index) const { return charAt(index); }
+
+	// Views between [beginIndex, endIndex), clamped to the view like String::substring
+	StringView substring(unsigned int beginIndex) const { return substring(beginIndex, len); }
+	StringView substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+	// search - returns -1 when not found, like String::indexOf
+	int find(char ch, unsigned int fromIndex = 0) const;
+	int find(StringView str, unsigned int fromIndex = 0) const;
+	int rfind(char ch) const;
+	int rfind(StringView str) const;
+
+	// comparison
+	bool equals(StringView other) const;
+	bool equalsIgnoreCase(StringView other) const;
+	int compareTo(StringView other) const;
+	bool startsWith(StringView prefix) const;
+	bool endsWith(StringView suffix) const;
+	bool operator == (StringView other) const { return equals(other); }
+	bool operator != (StringView other) const { return !equals(other); }
+
+	// View without leading/trailing whitespace
+	StringView trim(void) const;
+
+	// Tokenizing: returns the text up to the first delimiter and advances this
+	// view past it. When no delimiter is left the whole remainder is returned
+	// and the view becomes empty, so a loop ends with while (!rest.isEmpty()).
+	StringView split(char delim);
+	// Same, but splits on runs of whitespace and skips empty tokens
+	StringView nextWord(void);
+
+	// parsing/conversion - same leniency as String::toInt()/toFloat()
+	long toInt(void) const;
+	float toFloat(void) const;
+	double toDouble(void) const;
+	// Strict parsing: NUM_PARSE_OK only when the view holds nothing but the
+	// number (and surrounding whitespace); see num_parse.h for the rest
+	NumParseStatus parse(long &value) const { return num_parse_long(ptr, len, &value, NULL); }
+	NumParseStatus parse(unsigned long &value) const { return num_parse_ulong(ptr, len, &value, NULL); }
+	NumParseStatus parse(float &value) const { return num_parse_float(ptr, len, &value, NULL); }
+	NumParseStatus parse(double &value) const { return num_parse_double(ptr, len, &value, NULL); }
+
+	// Explicitly allocates an owning copy
+	String toString(void) const;
+
+private:
+	const char *ptr;
+	unsigned int len;
+};
+
+#endif  // __cplusplus
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Short critical sections for app state shared between contexts on one
+// core. On core 0, AppTask, Task_create tasks and AppDefer handlers
+// preempt each other; masking interrupts on the calling core also stops
+// FreeRTOS from switching tasks there. It does not exclude the other core.
+//
+//   uint32_t saved = app_critical_enter();
+//   ...
+//   app_critical_exit(saved);
+//
+// While masked, an overlay page fault cannot be taken (it escalates to a
+// HardFault), so the code in between must be APP_RESIDENT and must not
+// call library functions such as memcpy. Never make a syscall inside.
+
+__attribute__((always_inline)) static inline uint32_t app_critical_enter(void) {
+    uint32_t primask;
+    __asm__ volatile("mrs %0, primask\n\tcpsid i" : "=r"(primask) : : "memory");
+    return primask;
+}
+
+__attribute__((always_inline)) static inline void app_critical_exit(uint32_t primask) {
+    __asm__ volatile("msr primask, %0" : : "r"(primask) : "memory");
+}
+
+// Byte copy for masked sections (the volatile store keeps the compiler
+// from turning it into a memcpy call)
+__attribute__((always_inline)) static inline void app_critical_copy(void* dst, const void* src,
+                                                                    unsigned int len) {
+    volatile uint8_t* d = (volatile uint8_t*)dst;
+    const uint8_t* s = (const uint8_t*)src;
+    while (len-- != 0) {
+        *d++ = *s++;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Binary deferred-formatting logger.
+//
+//   APP_LOG("adc ch%u = %d (%.3f V)", ch, raw, volts);
+//
+// Nothing is formatted on the device. The format string goes into the
+// .logfmt ELF section, which is never loaded, and its offset there is the
+// record id. A call only copies the id, a microsecond timestamp and the raw
+// argument bytes into a per-core ring in app RAM - no syscall, no sprintf.
+// app_log_flush() sends the ring over Serial; on the host,
+// tools/log_decode.py rebuilds the text using the dictionary that
+// tools/log_gen.py extracts from app.elf at build time.
+//
+// Record: 0x1E, payload length (u8), id (u16), timestamp (u32, us), args.
+// Arguments are encoded by their C++ type, so they must match the
+// conversions: integers for %d/%i/%u/%x/%X/%o/%c (%lld/%llu for 64-bit),
+// floating point for %f/%e/%g (sent as float), const char* for %s (up to
+// APP_LOG_MAX_STRING bytes are copied).
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef APP_LOG_RING_SIZE
+#define APP_LOG_RING_SIZE 2048  // bytes per core
+#endif
+#define APP_LOG_SYNC 0x1E
+#define APP_LOG_MAX_PAYLOAD 255
+#define APP_LOG_MAX_STRING 32
+
+// Copy a finished record (sync byte included) into the calling core's ring.
+// Records that do not fit are dropped and counted.
+void app_log_record(const uint8_t* record, unsigned int len);
+
+// Send the calling core's ring over Serial (after any buffered text), then
+// a "records dropped" record if the ring overflowed since the last flush.
+void app_log_flush(void);
+
+// Records dropped on the calling core since boot
+uint32_t app_log_dropped(void);
+
+// Microsecond timestamp used in records (TIMER0 TIMERAWL, wraps at 2^32)
+static inline uint32_t app_log_time_us(void) {
+    return *(volatile const uint32_t*)0x400B0028u;
+}
+
+#ifdef __cplusplus
+}
+
+namespace app_log_detail {
+
+inline uint8_t* put32(uint8_t* p, uint32_t v) {
+    memcpy(p, &v, sizeof(v));
+    return p + sizeof(v);
+}
+
+inline uint8_t* put64(uint8_t* p, uint64_t v) {
+    memcpy(p, &v, sizeof(v));
+    return p + sizeof(v);
+}
+
+// One overload per argument kind. `end` bounds variable-length strings.
+inline uint8_t* put(uint8_t* p, const uint8_t*, int v) { return put32(p, (uint32_t)v); }
+inline uint8_t* put(uint8_t* p, const uint8_t*, unsigned int v) { return put32(p, v); }
+inline uint8_t* put(uint8_t* p, const uint8_t*, long v) { return put32(p, (uint32_t)v); }
+inline uint8_t* put(uint8_t* p, const uint8_t*, unsigned long v) { return put32(p, (uint32_t)v); }
+inline uint8_t* put(uint8_t* p, const uint8_t*, long long v) { return put64(p, (uint64_t)v); }
+inline uint8_t* put(uint8_t* p, const uint8_t*, unsigned long long v) { return put64(p, v); }
+inline uint8_t* put(uint8_t* p, const uint8_t*, double v) {
+    float f = (float)v;
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return put32(p, bits);
+}
+inline uint8_t* put(uint8_t* p, const uint8_t* end, const char* s) {
+    size_t n = s ? strnlen(s, APP_LOG_MAX_STRING) : 0;
+    if (n > (size_t)(end - p) - 1) n = (size_t)(end - p) - 1;
+    *p++ = (uint8_t)n;
+    memcpy(p, s, n);
+    return p + n;
+}
+inline uint8_t* put(uint8_t* p, const uint8_t*, const void* v) { return put32(p, (uint32_t)(uintptr_t)v); }
+
+// Narrow types promote like printf arguments
+inline uint8_t* put(uint8_t* p, const uint8_t* end, bool v) { return put(p, end, (int)v); }
+inline uint8_t* put(uint8_t* p, const uint8_t* end, char v) { return put(p, end, (int)v); }
+inline uint8_t* put(uint8_t* p, const uint8_t* end, signed char v) { return put(p, end, (int)v); }
+inline uint8_t* put(uint8_t* p, const uint8_t* end, unsigned char v) { return put(p, end, (int)v); }
+inline uint8_t* put(uint8_t* p, const uint8_t* end, short v) { return put(p, end, (int)v); }
+inline uint8_t* put(uint8_t* p, const uint8_t* end, unsigned short v) { return put(p, end, (int)v); }
+inline uint8_t* put(uint8_t* p, const uint8_t* end, float v) { return put(p, end, (double)v); }
+inline uint8_t* put(uint8_t* p, const uint8_t* end, char* s) { return put(p, end, (const char*)s); }
+
+template <typename... Args>
+inline void emit(const char* fmt, Args... args) {
+    // Fixed-size arguments take at most 8 bytes, a string 1 + APP_LOG_MAX_STRING
+    static_assert(sizeof...(Args) <= 7, "APP_LOG supports at most 7 arguments");
+    uint8_t record[2 + APP_LOG_MAX_PAYLOAD];
+    const uint8_t* end = record + sizeof(record);
+    uint8_t* p = record + 2;
+    const uintptr_t id = (uintptr_t)fmt;
+    *p++ = (uint8_t)id;
+    *p++ = (uint8_t)(id >> 8);
+    p = put32(p, app_log_time_us());
+    ((p = put(p, end, args)), ...);
+    record[0] = APP_LOG_SYNC;
+    record[1] = (uint8_t)(p - record - 2);
+    app_log_record(record, (unsigned int)(p - record));
+}
+
+}  // namespace app_log_detail
+
+// The format string must be a literal; its address in .logfmt is the id
+#define APP_LOG(fmt, ...)                                                       \
+    do {                                                                        \
+        static const char app_log_fmt_[] __attribute__((section(".logfmt"), used)) = fmt; \
+        app_log_detail::emit(app_log_fmt_, ##__VA_ARGS__);                      \
+    } while (0)
+
+#endif  // __cplusplus
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// loop() scheduling modes (see App_setLoopMode). Without any
+// configuration the kernel sleeps 1 ms after every loop(), which caps the
+// loop at 1 kHz.
+#define APP_LOOP_DELAY_1MS  0u  // legacy pacing
+#define APP_LOOP_FREE_RUN   1u  // back to back; lower-priority tasks on the core starve
+#define APP_LOOP_FIXED_RATE 2u  // every `param` ms, deadlines do not drift
+#define APP_LOOP_EVENT      3u  // on App_loopWake(), or after `param` ms (0 = never)
+
+struct AppLoopConfig {
+    uint32_t mode;
+    uint32_t param;
+};
+
+// Selects the mode loop() starts in, e.g. APP_LOOP_CONFIG(APP_LOOP_FIXED_RATE, 5);
+// at file scope. The app header points the kernel at this object, which
+// reads it as data before any overlay page is loaded, so it is resident.
+#ifdef __cplusplus
+#define APP_LOOP_CONFIG(mode, param) \
+    extern "C" APP_RESIDENT_CONST const AppLoopConfig app_loop_config = {(mode), (param)}
+#else
+#define APP_LOOP_CONFIG(mode, param) \
+    APP_RESIDENT_CONST const struct AppLoopConfig app_loop_config = {(mode), (param)}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
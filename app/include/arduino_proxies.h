@@ -14,123 +14,195 @@
 
 #include "app_syscalls.h"
 #include "WString.h"
+#include "num_format.h"
+#include "serial_tx.h"
+#include "app_log.h"
+#include "gpio_fast.h"
+#include "pin.h"
+#include "app_loop.h"
+#include "pio_program.h"
 
-// Arduino-style Serial proxy - forwards calls to syscall wrappers
+// Arduino-style Serial proxy - output goes through the app-side TX buffer
+// (serial_tx.h) and reaches the kernel one line at a time.
 struct SerialProxy {
   inline void begin(unsigned long baud) { Serial_begin(baud); }
-  inline size_t write(uint8_t b) { return Serial_write_b(b); }
-  inline void print(const char* s) { Serial_print_s(s); }
-  inline void println(const char* s) { Serial_println_s(s); }
-  inline void println() { Serial_println(); }
-  inline int available() { return Serial_available(); }
-  inline int read() { return Serial_read(); }
-  inline int peek() { return Serial_peek(); }
-  inline void flush() { Serial_flush(); }
-
-  // Integer to decimal string conversion
-  static inline void itoa10(int v, char* b) {
-    char* p = b;
-    if (v == 0) {
-      *p++ = '0';
-      *p = 0;
-      return;
-    }
-    bool neg = v < 0;
-    unsigned n = neg ? static_cast<unsigned>(-v) : static_cast<unsigned>(v);
-    char tmp[12];
-    unsigned i = 0;
-    while (n != 0 && i < sizeof(tmp)) {
-      tmp[i++] = '0' + (n % 10);
-      n /= 10;
-    }
-    if (neg) *p++ = '-';
-    while (i != 0) *p++ = tmp[--i];
-    *p = 0;
-  }
-
-  inline void print(int v) {
-    char buf[16];
-    itoa10(v, buf);
-    Serial_print_s(buf);
-  }
-  inline void println(int v) {
-    char buf[16];
-    itoa10(v, buf);
-    Serial_println_s(buf);
-  }
-  
-  inline void print(unsigned int v) {
-    char buf[16];
-    // Convert unsigned int to string
-    char* p = buf;
-    if (v == 0) {
-      *p++ = '0';
-      *p = 0;
-    } else {
-      char tmp[12];
-      unsigned i = 0;
-      unsigned n = v;
-      while (n != 0 && i < sizeof(tmp)) {
-        tmp[i++] = '0' + (n % 10);
-        n /= 10;
-      }
-      while (i != 0) *p++ = tmp[--i];
-      *p = 0;
-    }
-    Serial_print_s(buf);
+  inline size_t write(uint8_t b) { return serial_tx_write(reinterpret_cast<const char*>(&b), 1); }
+  inline size_t write(const uint8_t* data, size_t length) {
+    return serial_tx_write(reinterpret_cast<const char*>(data), length);
+  }
+  inline void print(const char* s) {
+    // Address 0 is readable bootrom on RP2350; strlen would not fault
+    if (s == nullptr) return;
+    serial_tx_write(s, strlen(s));
+  }
+  inline void println(const char* s) {
+    print(s);
+    println();
+  }
+  inline void println() { serial_tx_write("\r\n", 2); }
+
+  // Pending output is sent before input is polled, so prompts show up
+  inline int available() {
+    serial_tx_flush();
+    return Serial_available();
+  }
+  inline int read() {
+    serial_tx_flush();
+    return Serial_read();
+  }
+  inline int peek() {
+    serial_tx_flush();
+    return Serial_peek();
   }
-  
-  inline void println(unsigned int v) {
-    print(v);
-    Serial_println();
+  inline void flush() {
+    serial_tx_flush();
+    Serial_flush();
   }
 
-  // Long support - use sprintf for reliable formatting.
-  // Static buffer ensures valid memory location for kernel pointer validation.
-  inline void print(long v) {
-    static char buf[32];
-    sprintf(buf, "%ld", v);
-    Serial_print_s(buf);
+  // Bulk reads - one syscall per call instead of two per byte. They wait
+  // up to the timeout (1000 ms by default, like Arduino's Stream) for data.
+  inline void setTimeout(unsigned long ms) { timeout = ms; }
+  inline unsigned long getTimeout() const { return timeout; }
+  inline size_t readBytes(void* buf, size_t length) {
+    serial_tx_flush();
+    return Serial_readBuf(static_cast<uint8_t*>(buf), length, timeout);
   }
-  inline void println(long v) {
-    print(v);
-    Serial_println();
+  // Stops after `terminator`, which is consumed but not stored
+  inline size_t readBytesUntil(char terminator, void* buf, size_t length) {
+    serial_tx_flush();
+    return Serial_readUntil(static_cast<uint8_t*>(buf), length, static_cast<uint8_t>(terminator), timeout);
+  }
+  // Reads one '\n'-terminated line into a NUL-terminated buffer of `size`
+  // bytes, dropping a trailing '\r'. Returns the line length; 0 on timeout
+  // also covers an empty line.
+  inline size_t readLine(char* buf, size_t size) {
+    if (size == 0) return 0;
+    size_t n = readBytesUntil('\n', buf, size - 1);
+    if (n > 0 && buf[n - 1] == '\r') n--;
+    buf[n] = '\0';
+    return n;
+  }
+
+  // Numbers are formatted on the stack by the shared num_format core and
+  // queued with their known length - no sprintf, no static buffers.
+  inline void print(int v, int base = 10) { print((long)v, base); }
+  inline void println(int v, int base = 10) { println((long)v, base); }
+  inline void print(unsigned int v, int base = 10) { print((unsigned long)v, base); }
+  inline void println(unsigned int v, int base = 10) { println((unsigned long)v, base); }
+  // uint8_t prints as a number, as on Arduino; char stays a character
+  inline void print(unsigned char v, int base = 10) { print((unsigned long)v, base); }
+  inline void println(unsigned char v, int base = 10) { println((unsigned long)v, base); }
+
+  inline void print(long v, int base = 10) {
+    char buf[NUM_FMT_I32_BUF];
+    serial_tx_write(buf, num_fmt_i32(buf, v, base));
+  }
+  inline void println(long v, int base = 10) {
+    print(v, base);
+    println();
+  }
+  inline void print(unsigned long v, int base = 10) {
+    char buf[NUM_FMT_U32_BUF];
+    serial_tx_write(buf, num_fmt_u32(buf, v, base));
+  }
+  inline void println(unsigned long v, int base = 10) {
+    print(v, base);
+    println();
   }
 
-  // Char support.
-  // Static buffer ensures valid memory location for kernel pointer validation.
-  inline void print(char c) {
-    static char buf[2];
-    buf[0] = c;
-    buf[1] = 0;
-    Serial_print_s(buf);
+  // Floating point - two decimals by default like Arduino; pass
+  // NUM_FMT_SHORTEST for the shortest round-trip form.
+  inline void print(double v, int digits = 2) {
+    char buf[NUM_FMT_FLOAT_BUF + 17];
+    unsigned int n;
+    if (digits == NUM_FMT_SHORTEST) {
+      n = num_fmt_shortest(buf, v);
+    } else {
+      n = num_fmt_fixed(buf, v, digits < 0 ? 0 : (digits > 17 ? 17 : digits));
+    }
+    serial_tx_write(buf, n);
+  }
+  inline void println(double v, int digits = 2) {
+    print(v, digits);
+    println();
   }
+
+  inline void print(char c) { serial_tx_write(&c, 1); }
   inline void println(char c) {
     print(c);
-    Serial_println();
+    println();
   }
 
   // String support - defined after String class
   inline void print(const String& s);
   inline void println(const String& s);
+
+  unsigned long timeout = 1000;
 };
 
 // Global Serial object for app code
 inline SerialProxy Serial;
 
+// Arduino-style SPI settings - passed to the kernel as plain values
+struct SPISettings {
+  SPISettings() : clock(4000000), bitOrder(MSBFIRST), dataMode(SPI_MODE0) {}
+  SPISettings(uint32_t clock_hz, BitOrder order, SPIMode mode)
+      : clock(clock_hz), bitOrder(order), dataMode(mode) {}
+
+  uint32_t clock;
+  BitOrder bitOrder;
+  SPIMode dataMode;
+};
+
 // Arduino-style SPI proxy - forwards calls to syscall wrappers
 struct SPIProxy {
   inline void begin() { SPI_begin(); }
   inline void end() { SPI_end(); }
-  inline void beginTransaction() { SPI_beginTransaction(); }
+  inline void beginTransaction() { beginTransaction(SPISettings()); }
+  inline void beginTransaction(const SPISettings& settings) {
+    SPI_beginTransaction(settings.clock, settings.bitOrder, settings.dataMode);
+  }
   inline void endTransaction() { SPI_endTransaction(); }
   inline uint8_t transfer(uint8_t data) { return SPI_transfer(data); }
+
+  // Buffer transfers cost one syscall per call; the kernel uses DMA for
+  // large buffers. In-place like Arduino's SPI.transfer(buf, count), or
+  // full duplex with separate buffers (either may be NULL).
+  inline void transfer(void* buf, size_t count) {
+    SPI_transferBuf(static_cast<const uint8_t*>(buf), static_cast<uint8_t*>(buf), count);
+  }
+  inline void transfer(const void* tx, void* rx, size_t count) {
+    SPI_transferBuf(static_cast<const uint8_t*>(tx), static_cast<uint8_t*>(rx), count);
+  }
+  inline void write(const void* data, size_t count) {
+    SPI_writeBuf(static_cast<const uint8_t*>(data), count);
+  }
+
+  // Background DMA transfer, e.g. to push a frame buffer while rendering
+  // the next one. Returns 0 if it could not start. The buffers must be
+  // globals or heap (the kernel rejects stack buffers here) and stay valid
+  // until finishedAsync() is true.
+  inline uint32_t transferAsync(const void* tx, void* rx, size_t count) {
+    return SPI_transferAsync(static_cast<const uint8_t*>(tx), static_cast<uint8_t*>(rx), count);
+  }
+  inline bool finishedAsync(uint32_t handle) { return SPI_asyncDone(handle); }
 };
 
 // Global SPI object for app code
 inline SPIProxy SPI;
 
-// Arduino-style Wire (I2C) proxy - forwards calls to syscall wrappers
+// Results of the Wire register calls: bytes transferred (>= 0) or one of
+// these. An async status word reads WIRE_PENDING until the kernel stores
+// the final result.
+#define WIRE_PENDING          (-1)
+#define WIRE_ERR_ADDRESS_NACK (-2)
+#define WIRE_ERR_DATA_NACK    (-3)
+#define WIRE_ERR_OTHER        (-4)
+#define WIRE_ERR_SHORT_READ   (-5)  // fewer bytes than asked; those received are in buf
+
+// Arduino-style Wire (I2C) proxy - forwards calls to syscall wrappers. The
+// kernel stages byte-wise transactions per task, up to 128 bytes each way,
+// and only uses the bus inside endTransmission() and requestFrom().
 struct WireProxy {
   inline void begin() { Wire_begin(); }
   inline void end() { Wire_end(); }
@@ -141,6 +213,29 @@ struct WireProxy {
   inline size_t write(const uint8_t* data, size_t length) { return Wire_write_buf(data, length); }
   inline int available() { return Wire_available(); }
   inline int read() { return Wire_read(); }
+
+  // Register access in one syscall: write `reg`, then read or write `length`
+  // bytes (a read uses a repeated start). Replaces the usual
+  // beginTransmission/write/endTransmission/requestFrom/read sequence.
+  inline int32_t readRegister(uint8_t address, uint8_t reg, void* buf, size_t length) {
+    return Wire_readBuf(address, reg, static_cast<uint8_t*>(buf), length);
+  }
+  inline int32_t writeRegister(uint8_t address, uint8_t reg, const void* data, size_t length) {
+    return Wire_writeReg(address, reg, static_cast<const uint8_t*>(data), length);
+  }
+
+  // Queued variants, e.g. to poll a sensor while rendering. Returns false
+  // if the request could not be queued; otherwise *status reads
+  // WIRE_PENDING until the transfer ends. buf and status must be globals
+  // or heap, not stack locals, and stay valid until then.
+  inline bool readRegisterAsync(uint8_t address, uint8_t reg, void* buf, size_t length,
+                                volatile int32_t* status) {
+    return Wire_readBufAsync(address, reg, static_cast<uint8_t*>(buf), length, status);
+  }
+  inline bool writeRegisterAsync(uint8_t address, uint8_t reg, const void* data, size_t length,
+                                 volatile int32_t* status) {
+    return Wire_writeRegAsync(address, reg, static_cast<const uint8_t*>(data), length, status);
+  }
 };
 
 // Global Wire object for app code
@@ -148,11 +243,12 @@ inline WireProxy Wire;
 
 // Serial String support - implement after String is defined
 inline void SerialProxy::print(const String& s) {
-  Serial_print_s(s.c_str());
+  serial_tx_write(s.c_str(), s.length());
 }
 
 inline void SerialProxy::println(const String& s) {
-  Serial_println_s(s.c_str());
+  print(s);
+  println();
 }
 
 // Multicore helper - wraps syscall to accept function pointer directly
@@ -170,6 +266,123 @@ inline void multicore_launch_core1(void (*entry)(void)) {
   multicore_helpers::launch_core1_impl(reinterpret_cast<uintptr_t>(entry));
 }
 
+// Hardware timer helpers - accept APP_RESIDENT functions directly
+struct TimerStats {
+  uint32_t fired;       // callbacks run
+  uint32_t missed;      // periods skipped because their deadline had passed
+  uint32_t minLateUs;   // lateness = deadline to callback
+  uint32_t maxLateUs;   // maxLateUs - minLateUs is the jitter
+  uint32_t meanLateUs;
+};
+
+inline int32_t Timer_startRepeating(void (*callback)(void), uint32_t period_us) {
+  return Timer_startRepeating(reinterpret_cast<uintptr_t>(callback), period_us);
+}
+
+inline int32_t Timer_startOnce(void (*callback)(void), uint32_t delay_us) {
+  return Timer_startOnce(reinterpret_cast<uintptr_t>(callback), delay_us);
+}
+
+inline bool Timer_getStats(int32_t handle, TimerStats& stats) {
+  static_assert(sizeof(TimerStats) == 5 * sizeof(uint32_t), "TimerStats must match the kernel layout");
+  return Timer_getStats(handle, reinterpret_cast<uint32_t*>(&stats));
+}
+
+// GPIO edge capture (kernel/src/edge_capture.h). Pass pins as a bit mask:
+//
+//   EdgeCapture_start((1u << 2) | (1u << 3), EDGE_RISE | EDGE_FALL);
+//   EdgeRecord edges[64];
+//   uint32_t n = EdgeCapture_read(edges, 64);
+//
+// Timestamps are clk_sys cycles and wrap; subtract them as uint32_t and
+// divide by EdgeCapture_clockHz() / 1e6 for microseconds.
+#define EDGE_FALL 0x4u
+#define EDGE_RISE 0x8u
+
+struct EdgeRecord {
+  uint32_t cycles;
+  uint8_t pin;
+  uint8_t edge;  // EDGE_FALL or EDGE_RISE
+  uint16_t reserved;
+};
+
+inline uint32_t EdgeCapture_read(EdgeRecord* records, uint32_t max_records) {
+  static_assert(sizeof(EdgeRecord) == 8, "EdgeRecord must match the kernel layout");
+  return EdgeCapture_read(static_cast<void*>(records), max_records);
+}
+
+// PIO (kernel/src/app_pio.h). Programs come from app/pio/*.pio through the
+// generated pio_programs.h:
+//
+//   #include "pio_programs.h"
+//   int32_t prog = Pio_load(ws2812_program);
+//   const uint32_t cycles = ws2812_T1 + ws2812_T2 + ws2812_T3;
+//   PioSmConfig cfg = {800000 * cycles, PIO_NO_PIN, 0, PIO_NO_PIN, 0,
+//                      PIO_NO_PIN, LED_PIN, PIO_NO_PIN, PIO_AUTOPULL, 24, 0, 0};
+//   int32_t sm = Pio_smInit(prog, cfg);
+//   Pio_smEnable(sm, true);
+//   Pio_dmaPut(sm, pixels, count, 4);  // GRB in the top 24 bits
+inline int32_t Pio_load(const PioProgram& program) {
+  return Pio_load(static_cast<const void*>(&program));
+}
+
+inline int32_t Pio_smInit(int32_t program, const PioSmConfig& config) {
+  static_assert(sizeof(PioSmConfig) == 16, "PioSmConfig must match the kernel layout");
+  return Pio_smInit(program, static_cast<const void*>(&config));
+}
+
+inline bool Pio_put(int32_t sm, uint32_t word, uint32_t timeout_ms) {
+  return Pio_put(sm, &word, 1, timeout_ms) == 1;
+}
+
+// loop() statistics (App_getLoopStats); the loop rate is 1e6 / meanPeriodUs
+struct LoopStats {
+  uint32_t iterations;
+  uint32_t minPeriodUs;   // between loop() starts; max - min is the jitter
+  uint32_t maxPeriodUs;
+  uint32_t meanPeriodUs;
+  uint32_t meanBusyUs;    // time spent inside loop()
+  uint32_t maxBusyUs;
+};
+
+inline bool App_getLoopStats(LoopStats& stats) {
+  static_assert(sizeof(LoopStats) == 6 * sizeof(uint32_t), "LoopStats must match the kernel layout");
+  return App_getLoopStats(reinterpret_cast<uint32_t*>(&stats));
+}
+
+// Code overlay cache counters (Cache_getStats), per core
+struct CacheStats {
+  uint32_t loads;      // pages copied in from flash
+  uint32_t hits;       // page already present
+  uint32_t evictions;  // tracking slots reclaimed (the page stays loaded)
+  uint32_t faults;     // page misses that stalled this core
+  uint32_t stallUs;    // total stall time; stallUs / faults is the mean
+  uint32_t maxStallUs;
+};
+
+inline bool Cache_getStats(uint32_t core, CacheStats& stats) {
+  static_assert(sizeof(CacheStats) == 6 * sizeof(uint32_t), "CacheStats must match the kernel layout");
+  return Cache_getStats(core, reinterpret_cast<uint32_t*>(&stats));
+}
+
+// Pin a function's page (calls nest). Loaded pages are never removed, so
+// this only affects cache bookkeeping; Cache_pin() still loads the page.
+inline bool Cache_pin(void (*fn)()) { return Cache_pin(reinterpret_cast<uintptr_t>(fn)); }
+inline void Cache_unpin(void (*fn)()) { Cache_unpin(reinterpret_cast<uintptr_t>(fn)); }
+
+// App tasks, queues and event groups (kernel/src/app_tasks.h)
+#define APP_WAIT_FOREVER 0xFFFFFFFFu
+#define APP_EVENT_WAIT_ALL      0x1u  // Event_wait: all bits instead of any
+#define APP_EVENT_CLEAR_ON_EXIT 0x2u  // Event_wait: clear the bits that satisfied the wait
+
+// The entry must be APP_RESIDENT; returning from it or Task_delete(own
+// handle) ends the task. Tasks run at loop()'s priority whatever is passed.
+inline int32_t Task_create(void (*entry)(void*), void* arg, uint32_t stack_words = 1024,
+                           uint32_t priority = 1) {
+  return Task_create(reinterpret_cast<uintptr_t>(entry), reinterpret_cast<uintptr_t>(arg),
+                     stack_words, priority);
+}
+
 // BOOTSEL and softwareReset are available as syscalls
 // They're included via app_syscalls.h, so no wrapper needed
 // Just use BOOTSEL() and softwareReset() directly in your code
@@ -199,6 +412,39 @@ inline void attachInterrupt(uint8_t pin, void (*isr)(), int mode) {
 }
 // Note: detachInterrupt(uint8_t) is already generated in app_syscalls.h, so we don't need to wrap it
 
+// Deferred interrupt work (kernel/src/app_defer.h). The interrupt only
+// queues handler(arg); the kernel's AppDefer task runs it soon after, above
+// AppTask and app tasks, where every syscall is allowed and the handler
+// need not be APP_RESIDENT.
+#define DEFER_GPIO_PIN(arg)    ((uint8_t)((arg) & 0xFFu))
+#define DEFER_GPIO_EVENTS(arg) ((arg) >> 8)  // DEFER_GPIO_FALL and/or DEFER_GPIO_RISE
+#define DEFER_GPIO_FALL 0x4u
+#define DEFER_GPIO_RISE 0x8u
+
+struct DeferStats {
+  uint32_t run;           // handlers run
+  uint32_t dropped;       // posts that found the queue full
+  uint32_t minLatencyUs;  // latency = post to handler start
+  uint32_t maxLatencyUs;
+  uint32_t meanLatencyUs;
+  uint32_t maxDepth;      // most records ever waiting
+};
+
+// handler(arg) gets the pin and edge(s) in arg (DEFER_GPIO_PIN/EVENTS)
+inline void attachInterruptDeferred(uint8_t pin, void (*handler)(uint32_t), int mode) {
+  attachInterruptDeferred(pin, reinterpret_cast<uintptr_t>(handler), mode);
+}
+
+// From an ISR (or a task): run handler(arg) in the AppDefer task
+inline bool Defer_post(void (*handler)(uint32_t), uint32_t arg) {
+  return Defer_post(reinterpret_cast<uintptr_t>(handler), arg);
+}
+
+inline bool Defer_getStats(DeferStats& stats) {
+  static_assert(sizeof(DeferStats) == 6 * sizeof(uint32_t), "DeferStats must match the kernel layout");
+  return Defer_getStats(reinterpret_cast<uint32_t*>(&stats));
+}
+
 // WiFi proxy - forwards calls to syscall wrappers
 struct WiFiProxy {
   inline int begin(const char* ssid, const char* password) { return WiFi_begin(ssid, password); }
@@ -22,11 +22,38 @@ typedef enum {
   INPUT_PULLUP = 0x2,
 } PinMode;
 
+// SPI bit order and clock modes (numbering matches the Arduino core)
+typedef enum {
+  LSBFIRST = 0,
+  MSBFIRST = 1,
+} BitOrder;
+
+typedef enum {
+  SPI_MODE0 = 0,
+  SPI_MODE1 = 1,
+  SPI_MODE2 = 2,
+  SPI_MODE3 = 3,
+} SPIMode;
+
+// Code the kernel may call from interrupt context (timer callbacks) must
+// not live in the paged code overlay. APP_RESIDENT places a function in the
+// always-loaded .resident region; APP_RESIDENT_CONST does the same for
+// tables it reads. Anything such a function calls must be resident too (or
+// forced inline); app variables and the gpio_fast.h registers are fine.
+#define APP_RESIDENT       __attribute__((section(".resident"), noinline))
+#define APP_RESIDENT_CONST __attribute__((section(".resident_rodata")))
+
 // Interrupt modes
 #define CHANGE  0x01
 #define FALLING 0x02
 #define RISING  0x03
 
+// Number bases for Serial.print and String
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
 // ========= Math Helpers =========
 #define PI          3.14159265358979323846
 #define DEG_TO_RAD  0.01745329251994329577
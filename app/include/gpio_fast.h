@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Direct SIO access for pins the app owns.
+//
+// gpio_claim(mask) asks the kernel for a set of pins (bit n = GPIOn). Once
+// granted, the pins are under SIO control and the functions below drive
+// them with single store instructions - no syscall, no per-pin checks.
+// Only touch claimed pins: the SIO registers cover the whole port,
+// including pins the kernel uses (see gpio_claimed()).
+//
+//   if (gpio_claim(LCD_DATA_MASK | LCD_WR_MASK)) {
+//     gpio_fast_oe_set(LCD_DATA_MASK | LCD_WR_MASK);
+//     gpio_fast_put_masked(LCD_DATA_MASK, byte << LCD_D0);
+//     gpio_fast_clr(LCD_WR_MASK);
+//     gpio_fast_set(LCD_WR_MASK);
+//   }
+
+// RP2350 SIO register block (same address on both cores)
+#define SIO_BASE_ADDR        0xD0000000u
+#define SIO_CPUID_OFFSET     0x000u
+#define SIO_GPIO_IN_OFFSET   0x004u
+#define SIO_GPIO_OUT_OFFSET  0x010u
+#define SIO_GPIO_OUT_SET_OFFSET 0x018u
+#define SIO_GPIO_OUT_CLR_OFFSET 0x020u
+#define SIO_GPIO_OUT_XOR_OFFSET 0x028u
+#define SIO_GPIO_OE_OFFSET   0x030u
+#define SIO_GPIO_OE_SET_OFFSET  0x038u
+#define SIO_GPIO_OE_CLR_OFFSET  0x040u
+#define SIO_GPIO_OE_XOR_OFFSET  0x048u
+
+#define SIO_REG(offset) (*(volatile uint32_t*)(uintptr_t)(SIO_BASE_ADDR + (offset)))
+
+static inline void gpio_fast_set(uint32_t mask) { SIO_REG(SIO_GPIO_OUT_SET_OFFSET) = mask; }
+static inline void gpio_fast_clr(uint32_t mask) { SIO_REG(SIO_GPIO_OUT_CLR_OFFSET) = mask; }
+static inline void gpio_fast_xor(uint32_t mask) { SIO_REG(SIO_GPIO_OUT_XOR_OFFSET) = mask; }
+
+// Sets the pins in `mask` to the matching bits of `value`. One XOR store, so
+// pins outside `mask` are untouched even if the other core changes them
+// between the read and the write.
+static inline void gpio_fast_put_masked(uint32_t mask, uint32_t value) {
+    SIO_REG(SIO_GPIO_OUT_XOR_OFFSET) = (SIO_REG(SIO_GPIO_OUT_OFFSET) ^ value) & mask;
+}
+
+static inline uint32_t gpio_fast_get_all(void) { return SIO_REG(SIO_GPIO_IN_OFFSET); }
+
+// Core the caller runs on: 0 or 1. Always inlined, so APP_RESIDENT code
+// that runs with interrupts masked can use it.
+__attribute__((always_inline)) static inline uint32_t app_core_num(void) {
+    return SIO_REG(SIO_CPUID_OFFSET) & 1u;
+}
+
+// Output enables (1 = output)
+static inline void gpio_fast_oe_set(uint32_t mask) { SIO_REG(SIO_GPIO_OE_SET_OFFSET) = mask; }
+static inline void gpio_fast_oe_clr(uint32_t mask) { SIO_REG(SIO_GPIO_OE_CLR_OFFSET) = mask; }
+
+#ifdef __cplusplus
+}
+#endif
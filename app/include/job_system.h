@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fork/join job system running app jobs on both cores.
+//
+//   static void APP_RESIDENT fftStage(void* ctx, uint32_t begin, uint32_t end) { ... }
+//
+//   job_system_start();                       // once, on core 0
+//   parallel_for(1024, 64, fftStage, &state); // returns when all 1024 are done
+//
+//   JobCounter done = {0};
+//   job_submit(&done, filterLeft, &l, 0, 0);
+//   job_submit(&done, filterRight, &r, 0, 0);
+//   job_wait(&done);
+//
+// Each core owns a work-stealing deque (Chase-Lev): it pushes and pops jobs
+// at the bottom, and an idle core steals the oldest job from the top of the
+// other core's deque. job_wait() runs jobs while it waits, so a waiting
+// core keeps helping instead of blocking. Idle cores sleep in WFE and are
+// woken by the SEV that follows every push and completion.
+//
+// Core 1 only ever executes APP_RESIDENT jobs, so a stolen job never stalls
+// on overlay page loads and stays mapped while it runs. Jobs whose function
+// is not resident are kept on core 0's private list and never stolen, so
+// they still run correctly, just not in parallel. Mark job functions
+// APP_RESIDENT to get both cores.
+//
+// job_system_start() takes over core 1; do not combine it with
+// multicore_launch_core1(). Without it every job runs on core 0. The core-0
+// side holds AppTask while it waits, like a spin loop.
+
+#ifndef JOB_DEQUE_SIZE
+#define JOB_DEQUE_SIZE 64  // jobs per core, power of two
+#endif
+#define JOB_PINNED_SIZE 32  // non-resident jobs waiting for core 0
+
+typedef void (*JobFn)(void* arg, uint32_t begin, uint32_t end);
+
+// Number of submitted jobs that have not finished yet
+typedef struct {
+    volatile uint32_t pending;
+} JobCounter;
+
+typedef struct {
+    uint32_t executed[2];  // jobs run, per core
+    uint32_t stolen[2];    // of those, taken from the other core's deque
+    uint32_t inlined;      // run immediately because a queue was full
+} JobStats;
+
+// Launch the core 1 worker. Call once from core 0.
+bool job_system_start(void);
+
+// Queue fn(arg, begin, end) on the calling core; `counter` (may be NULL) is
+// incremented now and decremented when the job finishes. A job that cannot
+// be queued runs immediately.
+void job_submit(JobCounter* counter, JobFn fn, void* arg, uint32_t begin, uint32_t end);
+
+// Run queued jobs until `counter` reaches zero
+void job_wait(JobCounter* counter);
+
+// Split [0, count) into chunks of `grain` items (0 = eight chunks) and run
+// fn(arg, begin, end) on each; returns when all are done
+void parallel_for(uint32_t count, uint32_t grain, JobFn fn, void* arg);
+
+void job_system_stats(JobStats* out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Number formatting core shared by itoa/dtostrf, String and the Serial proxy.
+//
+// Every function writes a NUL-terminated string to `out` and returns its
+// length (excluding the NUL), so callers never need a strlen() pass.
+// Digits are produced directly in their final position - no reverse pass.
+
+// Buffer sizes (including the NUL) that are always large enough
+#define NUM_FMT_U32_BUF   33   // base 2, 32 digits
+#define NUM_FMT_I32_BUF   34   // base 2 + sign
+#define NUM_FMT_U64_BUF   21   // base 10 only
+#define NUM_FMT_FLOAT_BUF 26   // num_fmt_shortest / num_fmt_shortest_f
+
+// Pass as decimalPlaces (String) or digits (Serial.print) to request the
+// shortest representation that reads back to exactly the same value.
+#define NUM_FMT_SHORTEST 0xFF
+
+// Integers. Bases 2..36 are accepted; 2, 4, 8, 16 and 32 use shifts and
+// masks, base 10 emits two digits per step from a lookup table. An invalid
+// base yields an empty string. Signed values get a '-' in base 10 only; in
+// other bases the two's complement bit pattern is printed (avr-libc rules).
+unsigned int num_fmt_u32(char* out, uint32_t value, unsigned int base);
+unsigned int num_fmt_i32(char* out, int32_t value, unsigned int base);
+unsigned int num_fmt_u64(char* out, uint64_t value);
+
+// Fixed-point, digit for digit identical to printf("%.*f") (exact ties
+// round to even) as long as |value| * 10^decimals < 1e18 and decimals <= 22.
+// Past that, decimals that a double cannot carry are padded with zeros,
+// and magnitudes of 1e18 or more switch to num_fmt_shortest (exponent
+// form), keeping the output within sign + 21 digits + decimals + 2.
+unsigned int num_fmt_fixed(char* out, double value, unsigned int decimals);
+
+// Shortest decimal string that parses back to exactly `value` (Grisu2).
+// Uses plain notation for decimal exponents in [-6, 21) and "1.5e-7" style
+// outside that range; integral values keep a trailing ".0".
+unsigned int num_fmt_shortest(char* out, double value);
+unsigned int num_fmt_shortest_f(char* out, float value);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Number parsing core used by String/StringView and usable on raw buffers.
+//
+// Inputs are (pointer, length) - no NUL terminator is needed and nothing is
+// copied. Leading whitespace and a '+'/'-' sign are accepted like atol()
+// and atof(). `consumed` (may be NULL) receives the offset just past the
+// last character that belongs to the number, and *out always receives a
+// usable value: 0 when nothing was parsed, the saturated value on overflow.
+// Neither locale nor errno is involved.
+
+typedef enum {
+    NUM_PARSE_OK = 0,     // a number, optionally followed by whitespace only
+    NUM_PARSE_TRAILING,   // a number followed by other characters
+    NUM_PARSE_EMPTY,      // no digits at all (empty, blank or not a number)
+    NUM_PARSE_OVERFLOW    // out of range for the target type; *out saturated
+} NumParseStatus;
+
+NumParseStatus num_parse_long(const char* s, unsigned int len, long* out, unsigned int* consumed);
+NumParseStatus num_parse_ulong(const char* s, unsigned int len, unsigned long* out, unsigned int* consumed);
+
+// Decimal floating point: digits, optional fraction, optional exponent, or
+// "inf"/"infinity"/"nan" in any case. Most real-world inputs (up to 15
+// significant digits with small exponents) are converted exactly with one
+// multiply or divide; the rest are copied as written and passed to
+// strtod()/strtof(), so they round as the C library does. Numbers written
+// with 128 or more characters are rounded from their first 19 significant
+// digits and may be one ulp off.
+NumParseStatus num_parse_double(const char* s, unsigned int len, double* out, unsigned int* consumed);
+NumParseStatus num_parse_float(const char* s, unsigned int len, float* out, unsigned int* consumed);
+
+#ifdef __cplusplus
+}
+#endif
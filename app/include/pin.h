@@ -0,0 +1,102 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include <stdint.h>
+
+#include "app_syscalls.h"
+#include "gpio_fast.h"
+
+// Compile-time typed pins on top of claimed-pin SIO access (gpio_fast.h).
+//
+//   using Led = Pin<15>;                 // OUTPUT by default
+//   using Button = Pin<14, INPUT_PULLUP>;
+//
+//   Led::begin(); Button::begin();
+//   Led::write(!Button::read());         // two loads/stores, no branch
+//
+// The pin number and mode are template arguments, so masks and register
+// addresses fold to constants, invalid pins fail to compile, and calling
+// write() on an input is a compile error rather than a runtime check.
+// begin() claims the pin from the kernel and must succeed before use.
+
+namespace pin_detail {
+// Pico 2 W radio pins (GPIO23/24/25/29) are never granted - see gpio_claim
+constexpr uint32_t kReservedMask = (1u << 23) | (1u << 24) | (1u << 25) | (1u << 29);
+
+constexpr bool validPin(uint8_t n) {
+    return n < NUM_DIGITAL_PINS && ((kReservedMask >> n) & 1u) == 0;
+}
+
+constexpr bool validMode(PinMode m) {
+    return m == INPUT || m == OUTPUT || m == INPUT_PULLUP;
+}
+}  // namespace pin_detail
+
+template <uint8_t N, PinMode M = OUTPUT>
+struct Pin {
+    static_assert(pin_detail::validPin(N), "Pin<N>: not a usable GPIO on this board");
+    static_assert(pin_detail::validMode(M), "Pin<N, Mode>: unsupported mode");
+
+    static constexpr uint8_t number = N;
+    static constexpr PinMode mode = M;
+    static constexpr uint32_t mask = 1u << N;
+
+    // Claims the pin and applies the mode (pulls, direction). False if the
+    // kernel refused the claim, e.g. because a peripheral uses the pin.
+    static bool begin() {
+        if (!gpio_claim(mask)) return false;
+        pinMode(N, M);
+        return true;
+    }
+    static void end() { gpio_release(mask); }
+
+    static inline void set() {
+        static_assert(M == OUTPUT, "Pin::set() needs an OUTPUT pin");
+        gpio_fast_set(mask);
+    }
+    static inline void clear() {
+        static_assert(M == OUTPUT, "Pin::clear() needs an OUTPUT pin");
+        gpio_fast_clr(mask);
+    }
+    static inline void toggle() {
+        static_assert(M == OUTPUT, "Pin::toggle() needs an OUTPUT pin");
+        gpio_fast_xor(mask);
+    }
+    // OUT_SET and OUT_CLR are 8 bytes apart; the value picks the register
+    static inline void write(bool high) {
+        static_assert(M == OUTPUT, "Pin::write() needs an OUTPUT pin");
+        SIO_REG(SIO_GPIO_OUT_CLR_OFFSET - 8u * (uint32_t)high) = mask;
+    }
+
+    static inline bool read() { return (gpio_fast_get_all() >> N) & 1u; }
+};
+
+// Contiguous output pins driven as one parallel bus, e.g. an 8-bit LCD
+// data port: PinBus<8, 8>::write(byte) updates GPIO8..15 with one store.
+template <uint8_t Base, uint8_t Width>
+struct PinBus {
+    static_assert(Width >= 1 && Width <= 32 && Base + Width <= NUM_DIGITAL_PINS,
+                  "PinBus<Base, Width>: pins out of range");
+    static_assert((((Width == 32 ? 0xFFFFFFFFu : ((1u << Width) - 1u)) << Base) &
+                   pin_detail::kReservedMask) == 0,
+                  "PinBus<Base, Width>: includes a reserved pin");
+
+    static constexpr uint32_t mask = (Width == 32 ? 0xFFFFFFFFu : ((1u << Width) - 1u)) << Base;
+
+    static bool begin() {
+        if (!gpio_claim(mask)) return false;
+        gpio_fast_clr(mask);
+        gpio_fast_oe_set(mask);
+        return true;
+    }
+    static void end() {
+        gpio_fast_oe_clr(mask);
+        gpio_release(mask);
+    }
+
+    static inline void write(uint32_t value) { gpio_fast_put_masked(mask, value << Base); }
+    static inline uint32_t read() { return (gpio_fast_get_all() & mask) >> Base; }
+};
+
+#endif  // __cplusplus
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+// PIO programs and state machine setup (kernel/src/app_pio.h).
+//
+// Put .pio sources in app/pio/; the build assembles them with
+// tools/pio_asm.py into src/generated/pio_programs.h, which defines one
+// <name>_program per .program plus <name>_offset_<label> for public labels
+// and <name>_<define> for public defines. Load a program with Pio_load()
+// and start state machines on it with Pio_smInit().
+
+// PioProgram.sideset_flags
+#define PIO_SIDESET_OPT     0x1u
+#define PIO_SIDESET_PINDIRS 0x2u
+
+// PioSmConfig.flags
+#define PIO_OUT_SHIFT_RIGHT 0x01u
+#define PIO_IN_SHIFT_RIGHT  0x02u
+#define PIO_AUTOPULL        0x04u
+#define PIO_AUTOPUSH        0x08u
+#define PIO_FIFO_JOIN_TX    0x10u  // 8-deep TX FIFO, no RX
+#define PIO_FIFO_JOIN_RX    0x20u  // 8-deep RX FIFO, no TX
+
+#define PIO_NO_PIN 0xFFu
+
+// Emitted by pio_asm.py; layout matches AppPioProgram in the kernel
+struct PioProgram {
+    const uint16_t* instructions;
+    uint8_t length;
+    int8_t origin;          // -1: anywhere
+    uint8_t wrap_target;
+    uint8_t wrap;
+    uint8_t sideset_bits;   // without the enable bit of an optional side-set
+    uint8_t sideset_flags;
+    uint16_t reserved;
+};
+
+struct PioSmConfig {
+    uint32_t freq_hz;        // state machine clock; 0 runs at clk_sys
+    uint8_t out_base;        // PIO_NO_PIN or a count of 0 leaves a group unset
+    uint8_t out_count;
+    uint8_t set_base;
+    uint8_t set_count;
+    uint8_t in_base;
+    uint8_t sideset_base;    // count comes from the program
+    uint8_t jmp_pin;
+    uint8_t flags;
+    uint8_t pull_threshold;  // 1..32, 0 = 32
+    uint8_t push_threshold;
+    uint16_t reserved;
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// App-side transmit buffer behind the Serial proxy.
+//
+// Output is collected in the app and handed to the kernel with a single
+// Serial_writeBuf syscall when a newline is written, when the buffer runs
+// full, or on serial_tx_flush(). Each core has its own buffer. On core 0,
+// AppTask, app tasks and AppDefer handlers share one buffer and can
+// preempt each other, so appends and drains run with interrupts masked
+// (app_critical.h): the bytes of one call stay together, but a line built
+// from several calls can be split by another task's output.
+// Not for use from interrupt callbacks.
+
+#define SERIAL_TX_BUF_SIZE 128
+
+// Queue `len` bytes; returns `len`. Writes larger than the buffer go to the
+// kernel directly (after whatever is already queued).
+size_t serial_tx_write(const char* data, size_t len);
+
+// Send everything queued on the calling core
+void serial_tx_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
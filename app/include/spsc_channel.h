@@ -0,0 +1,172 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "gpio_fast.h"
+
+// Lock-free single-producer / single-consumer channels between the cores.
+//
+//   struct Block { uint16_t samples[2048]; };
+//   static SpscChannel<Block, 4> g_blocks;      // app RAM, visible to both cores
+//
+//   // core 1 (producer)                  // core 0 (consumer)
+//   Block* b = g_blocks.acquire();        const Block* b = g_blocks.peek();
+//   fill(b->samples);                     if (b) { use(b); g_blocks.release(); }
+//   g_blocks.commit();
+//
+// Records are fixed-size and live in the channel's slots, so acquire()/
+// commit() and peek()/release() hand them over without copying and without
+// the kernel. push()/pop() are copying conveniences. Exactly one core may
+// produce and one may consume per channel.
+//
+// commit() and release() execute SEV, so a core blocked in a wait_*() call
+// (WFE) wakes as soon as the other side makes progress. On core 0 that wait
+// holds the CPU like a spin loop, with interrupts and higher-priority
+// tasks still preempting it; poll with the try_ forms instead if AppTask must
+// not monopolise the core.
+//
+// spsc_doorbell_ring() can additionally push a token through the SIO FIFO
+// from core 0 to core 1, e.g. to tell core 1 which of several channels has
+// data. The other direction carries the kernel's syscall proxy and is not
+// available.
+
+#define SIO_FIFO_ST_OFFSET 0x050u
+#define SIO_FIFO_WR_OFFSET 0x054u
+#define SIO_FIFO_RD_OFFSET 0x058u
+#define SIO_FIFO_ST_VLD    0x1u
+#define SIO_FIFO_ST_RDY    0x2u
+
+namespace spsc_detail {
+inline void sev() { __asm__ volatile("dsb\n\tsev" ::: "memory"); }
+inline void wfe() { __asm__ volatile("wfe" ::: "memory"); }
+}  // namespace spsc_detail
+
+template <typename T, uint32_t N>
+class SpscChannel {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscChannel<T, N>: N must be a power of two");
+
+public:
+    static constexpr uint32_t capacity = N;
+
+    // ----- producer side -----
+
+    // Next free slot, or nullptr if the channel is full
+    T* acquire() {
+        const uint32_t head = head_;
+        if (head - tailCache_ == N) {
+            tailCache_ = __atomic_load_n(&tail_, __ATOMIC_ACQUIRE);
+            if (head - tailCache_ == N) return nullptr;
+        }
+        return &slots_[head & (N - 1)];
+    }
+
+    // Publish the slot returned by acquire()
+    void commit() {
+        __atomic_store_n(&head_, head_ + 1, __ATOMIC_RELEASE);
+        spsc_detail::sev();
+    }
+
+    bool try_push(const T& item) {
+        T* slot = acquire();
+        if (!slot) return false;
+        memcpy(slot, &item, sizeof(T));
+        commit();
+        return true;
+    }
+
+    // Sleeps (WFE) until a slot is free
+    T* wait_acquire() {
+        T* slot;
+        while ((slot = acquire()) == nullptr) spsc_detail::wfe();
+        return slot;
+    }
+
+    void push(const T& item) {
+        memcpy(wait_acquire(), &item, sizeof(T));
+        commit();
+    }
+
+    // ----- consumer side -----
+
+    // Oldest unread record, or nullptr if the channel is empty
+    const T* peek() {
+        const uint32_t tail = tail_;
+        if (tail == headCache_) {
+            headCache_ = __atomic_load_n(&head_, __ATOMIC_ACQUIRE);
+            if (tail == headCache_) return nullptr;
+        }
+        return &slots_[tail & (N - 1)];
+    }
+
+    // Hand the slot returned by peek() back to the producer
+    void release() {
+        __atomic_store_n(&tail_, tail_ + 1, __ATOMIC_RELEASE);
+        spsc_detail::sev();
+    }
+
+    bool try_pop(T& item) {
+        const T* slot = peek();
+        if (!slot) return false;
+        memcpy(&item, slot, sizeof(T));
+        release();
+        return true;
+    }
+
+    // Sleeps (WFE) until a record arrives
+    const T* wait_peek() {
+        const T* slot;
+        while ((slot = peek()) == nullptr) spsc_detail::wfe();
+        return slot;
+    }
+
+    void pop(T& item) {
+        memcpy(&item, wait_peek(), sizeof(T));
+        release();
+    }
+
+    // ----- either side -----
+
+    // Approximate from the other side, exact from the calling side's view
+    uint32_t size() const {
+        return __atomic_load_n(&head_, __ATOMIC_ACQUIRE) - __atomic_load_n(&tail_, __ATOMIC_ACQUIRE);
+    }
+    bool empty() const { return size() == 0; }
+
+private:
+    // Free-running counters; the slot index is the low bits. Each side
+    // caches the other's counter and rereads it only when it looks stuck.
+    volatile uint32_t head_ = 0;  // written by the producer
+    uint32_t tailCache_ = 0;      // producer's copy of tail_
+    volatile uint32_t tail_ = 0;  // written by the consumer
+    uint32_t headCache_ = 0;      // consumer's copy of head_
+    T slots_[N];
+};
+
+// Core 0 only: queue a token for core 1. Returns false if the FIFO is full;
+// the SEV from commit() has already woken core 1 in that case.
+static inline bool spsc_doorbell_ring(uint32_t token) {
+    if (!(SIO_REG(SIO_FIFO_ST_OFFSET) & SIO_FIFO_ST_RDY)) return false;
+    SIO_REG(SIO_FIFO_WR_OFFSET) = token;
+    spsc_detail::sev();
+    return true;
+}
+
+// Core 1 only: take a pending token, if any
+static inline bool spsc_doorbell_poll(uint32_t* token) {
+    if (!(SIO_REG(SIO_FIFO_ST_OFFSET) & SIO_FIFO_ST_VLD)) return false;
+    *token = SIO_REG(SIO_FIFO_RD_OFFSET);
+    return true;
+}
+
+// Core 1 only: sleep until a token arrives
+static inline uint32_t spsc_doorbell_wait(void) {
+    uint32_t token;
+    while (!spsc_doorbell_poll(&token)) spsc_detail::wfe();
+    return token;
+}
+
+#endif  // __cplusplus
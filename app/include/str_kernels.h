@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Word-at-a-time (SWAR) string kernels used by String and StringView.
+//
+// Each kernel works on (pointer, length) and handles four characters per
+// step. On the Cortex-M33 the byte-lane tests use the DSP SIMD instructions
+// (UADD8/USUB8 + SEL); elsewhere a portable bit-trick fallback produces the
+// same results. Case mapping is ASCII-only, matching tolower()/toupper() in
+// the "C" locale. Search functions return NULL when nothing matches.
+
+const char* str_find_char(const char* s, unsigned int len, char c);
+const char* str_rfind_char(const char* s, unsigned int len, char c);
+const char* str_find(const char* s, unsigned int len, const char* needle, unsigned int needleLen);
+const char* str_rfind(const char* s, unsigned int len, const char* needle, unsigned int needleLen);
+
+void str_to_lower(char* s, unsigned int len);
+void str_to_upper(char* s, unsigned int len);
+void str_replace_char(char* s, unsigned int len, char find, char replace);
+
+// Non-zero when a and b are equal ignoring ASCII case (both are len bytes)
+int str_equals_ignore_case(const char* a, const char* b, unsigned int len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,5 +1,16 @@
 #include "WString.h"
 #include "arduino_utils.h"
+#include "num_format.h"
+#include "str_kernels.h"
+
+// Growth policy for appends: small buffers double, larger ones grow by half,
+// and a single step never over-allocates by more than kStringMaxGrowth bytes.
+// The app heap is a bump allocator, so every reallocation that can't extend
+// in place leaks the old block - fewer, larger steps waste far less memory
+// than growing by exactly the appended length each time.
+static const unsigned int kStringMinCapacity = 16;
+static const unsigned int kStringDoublingLimit = 256;
+static const unsigned int kStringMaxGrowth = 1024;
 
 /*********************************************/
 /*  Constructors                             */
@@ -21,6 +32,20 @@ String::String(const String &value)
 	}
 }
 
+String::String(String &&rval)
+{
+	init();
+	move(rval);
+}
+
+String::String(StringView view)
+{
+	init();
+	if (view.length()) {
+		copy(view.data(), view.length());
+	}
+}
+
 String::String(const __FlashStringHelper *pstr)
 {
 	init();
@@ -40,57 +65,63 @@ String::String(char c)
 String::String(unsigned char value, unsigned char base)
 {
 	init();
-	char buf[1 + 8 * sizeof(unsigned char)];
-	utoa(value, buf, base);
-	*this = buf;
+	char buf[NUM_FMT_U32_BUF];
+	copy(buf, num_fmt_u32(buf, value, base));
 }
 
 String::String(int value, unsigned char base)
 {
 	init();
-	char buf[2 + 8 * sizeof(int)];
-	itoa(value, buf, base);
-	*this = buf;
+	char buf[NUM_FMT_I32_BUF];
+	copy(buf, num_fmt_i32(buf, value, base));
 }
 
 String::String(unsigned int value, unsigned char base)
 {
 	init();
-	char buf[1 + 8 * sizeof(unsigned int)];
-	utoa(value, buf, base);
-	*this = buf;
+	char buf[NUM_FMT_U32_BUF];
+	copy(buf, num_fmt_u32(buf, value, base));
 }
 
 String::String(long value, unsigned char base)
 {
 	init();
-	char buf[2 + 8 * sizeof(long)];
-	ltoa(value, buf, base);
-	*this = buf;
+	char buf[NUM_FMT_I32_BUF];
+	copy(buf, num_fmt_i32(buf, value, base));
 }
 
 String::String(unsigned long value, unsigned char base)
 {
 	init();
-	char buf[1 + 8 * sizeof(unsigned long)];
-	ultoa(value, buf, base);
-	*this = buf;
+	char buf[NUM_FMT_U32_BUF];
+	copy(buf, num_fmt_u32(buf, value, base));
 }
 
+// decimalPlaces == NUM_FMT_SHORTEST selects the shortest round-trip form;
+// anything else keeps Arduino's dtostrf(value, decimalPlaces + 2, ...)
+// output, including its space padding when the number is narrower.
 String::String(float value, unsigned char decimalPlaces)
 {
 	init();
-	char buf[33];
-	char* str = dtostrf(value, (decimalPlaces + 2), decimalPlaces, buf);
-	*this = str;
+	if (decimalPlaces == NUM_FMT_SHORTEST) {
+		char buf[NUM_FMT_FLOAT_BUF];
+		copy(buf, num_fmt_shortest_f(buf, value));
+		return;
+	}
+	char buf[NUM_FMT_FLOAT_BUF + 256];
+	*this = dtostrf(value, (decimalPlaces + 2), decimalPlaces, buf);
 }
 
 String::String(double value, unsigned char decimalPlaces)
 {
 	init();
-	char buf[33];
-	char* str = dtostrf(value, (decimalPlaces + 2), decimalPlaces, buf);
-	*this = str;
+	if (decimalPlaces == NUM_FMT_SHORTEST) {
+		char buf[NUM_FMT_FLOAT_BUF];
+		copy(buf, num_fmt_shortest(buf, value));
+		return;
+	}
+	char buf[NUM_FMT_FLOAT_BUF + 256];
+	*this = dtostrf(value, (decimalPlaces + 2), decimalPlaces, buf);
 }
 
 String::~String()
@@ -126,6 +157,23 @@ unsigned char String::reserve(unsigned int size)
 	return 0;
 }
 
+unsigned char String::grow(unsigned int minCapacity)
+{
+	if (buffer && capacity >= minCapacity) return 1;
+	unsigned int newCapacity = (capacity < kStringDoublingLimit)
+		? capacity * 2
+		: capacity + capacity / 2;
+	if (newCapacity - capacity > kStringMaxGrowth) newCapacity = capacity + kStringMaxGrowth;
+	if (newCapacity < kStringMinCapacity) newCapacity = kStringMinCapacity;
+	if (newCapacity < minCapacity) newCapacity = minCapacity;
+	if (changeBuffer(newCapacity)) {
+		if (len == 0) buffer[0] = 0;
+		return 1;
+	}
+	// Heap too tight for the rounded-up size - settle for an exact fit
+	return reserve(minCapacity);
+}
+
 unsigned char String::changeBuffer(unsigned int maxStrLen)
 {
 	// For new allocations (buffer is NULL), use malloc directly
@@ -158,7 +206,8 @@ String & String::copy(const char *cstr, unsigned int length)
 	
 	if (reserve(length)) {
 		len = length;
-		strcpy(buffer, cstr);
+		memcpy(buffer, cstr, length);
+		buffer[len] = 0;
 		return *this;
 	}
 	
@@ -175,10 +224,21 @@ String & String::copy(const __FlashStringHelper *pstr, unsigned int length)
 	}
 	len = length;
 	// For non-AVR platforms, treat as regular string
-	strcpy(buffer, reinterpret_cast<const char*>(pstr));
+	memcpy(buffer, reinterpret_cast<const char*>(pstr), length);
+	buffer[len] = 0;
 	return *this;
 }
 
+void String::move(String &rhs)
+{
+	if (this == &rhs) return;
+	free(buffer);
+	buffer = rhs.buffer;
+	capacity = rhs.capacity;
+	len = rhs.len;
+	rhs.init();
+}
+
 String & String::operator = (const String &rhs)
 {
 	if (this == &rhs) return *this;
@@ -203,6 +263,12 @@ String & String::operator = (const char *cstr)
 	return *this;
 }
 
+String & String::operator = (String &&rval)
+{
+	move(rval);
+	return *this;
+}
+
 String & String::operator = (const __FlashStringHelper *pstr)
 {
 	if (pstr) copy(pstr, strlen(reinterpret_cast<const char*>(pstr)));
@@ -216,6 +282,7 @@ String & String::operator = (const __FlashStringHelper *pstr)
 
 unsigned char String::concat(const String &s)
 {
+	if (s.len == 0) return 1;
 	return concat(s.buffer, s.len);
 }
 
@@ -224,9 +291,18 @@ unsigned char String::concat(const char *cstr, unsigned int length)
 	unsigned int newlen = len + length;
 	if (!cstr) return 0;
 	if (length == 0) return 1;
-	if (!reserve(newlen)) return 0;
-	strcpy(buffer + len, cstr);
+	// Appending (part of) ourselves: remember the offset, since growing
+	// may move the buffer out from under cstr
+	if (buffer && cstr >= buffer && cstr < buffer + len) {
+		unsigned int offset = cstr - buffer;
+		if (!grow(newlen)) return 0;
+		cstr = buffer + offset;
+	} else if (!grow(newlen)) {
+		return 0;
+	}
+	memcpy(buffer + len, cstr, length);
 	len = newlen;
+	buffer[len] = 0;
 	return 1;
 }
 
@@ -238,72 +314,61 @@ unsigned char String::concat(const char *cstr)
 
 unsigned char String::concat(char c)
 {
-	char buf[2];
-	buf[0] = c;
-	buf[1] = 0;
-	return concat(buf, 1);
+	if (!grow(len + 1)) return 0;
+	buffer[len++] = c;
+	buffer[len] = 0;
+	return 1;
 }
 
 unsigned char String::concat(unsigned char num)
 {
-	char buf[1 + 3 * sizeof(unsigned char)];
-	itoa(num, buf, 10);
-	return concat(buf, strlen(buf));
+	char buf[4];
+	return concat(buf, num_fmt_u32(buf, num, 10));
 }
 
 unsigned char String::concat(int num)
 {
-	char buf[2 + 3 * sizeof(int)];
-	itoa(num, buf, 10);
-	return concat(buf, strlen(buf));
+	char buf[12];
+	return concat(buf, num_fmt_i32(buf, num, 10));
 }
 
 unsigned char String::concat(unsigned int num)
 {
-	char buf[1 + 3 * sizeof(unsigned int)];
-	utoa(num, buf, 10);
-	return concat(buf, strlen(buf));
+	char buf[11];
+	return concat(buf, num_fmt_u32(buf, num, 10));
 }
 
 unsigned char String::concat(long num)
 {
-	char buf[2 + 3 * sizeof(long)];
-	ltoa(num, buf, 10);
-	return concat(buf, strlen(buf));
+	char buf[12];
+	return concat(buf, num_fmt_i32(buf, num, 10));
 }
 
 unsigned char String::concat(unsigned long num)
 {
-	char buf[1 + 3 * sizeof(unsigned long)];
-	ultoa(num, buf, 10);
-	return concat(buf, strlen(buf));
+	char buf[11];
+	return concat(buf, num_fmt_u32(buf, num, 10));
 }
 
+// Two decimals like Arduino's dtostrf(num, 4, 2, ...); the width never
+// pads because "0.00" is already four characters.
 unsigned char String::concat(float num)
 {
-	char buf[20];
-	char* string = dtostrf(num, 4, 2, buf);
-	return concat(string, strlen(string));
+	char buf[NUM_FMT_FLOAT_BUF];
+	return concat(buf, num_fmt_fixed(buf, num, 2));
 }
 
 unsigned char String::concat(double num)
 {
-	char buf[20];
-	char* string = dtostrf(num, 4, 2, buf);
-	return concat(string, strlen(string));
+	char buf[NUM_FMT_FLOAT_BUF];
+	return concat(buf, num_fmt_fixed(buf, num, 2));
 }
 
 unsigned char String::concat(const __FlashStringHelper * str)
 {
 	if (!str) return 0;
 	const char* cstr = reinterpret_cast<const char*>(str);
-	int length = strlen(cstr);
-	if (length == 0) return 1;
-	unsigned int newlen = len + length;
-	if (!reserve(newlen)) return 0;
-	strcpy(buffer + len, cstr);
-	len = newlen;
-	return 1;
+	return concat(cstr, strlen(cstr));
 }
 
 /*********************************************/
@@ -438,30 +503,26 @@ unsigned char String::equalsIgnoreCase( const String &s2 ) const
 	if (this == &s2) return 1;
 	if (len != s2.len) return 0;
 	if (len == 0) return 1;
-	const char *p1 = buffer;
-	const char *p2 = s2.buffer;
-	while (*p1) {
-		if (tolower(*p1++) != tolower(*p2++)) return 0;
-	} 
-	return 1;
+	return str_equals_ignore_case(buffer, s2.buffer, len) ? 1 : 0;
 }
 
-unsigned char String::startsWith( const String &s2 ) const
+unsigned char String::startsWith( StringView prefix ) const
 {
-	if (len < s2.len) return 0;
-	return startsWith(s2, 0);
+	return startsWith(prefix, 0);
 }
 
-unsigned char String::startsWith( const String &s2, unsigned int offset ) const
+unsigned char String::startsWith( StringView prefix, unsigned int offset ) const
 {
-	if (offset > len - s2.len || !buffer || !s2.buffer) return 0;
-	return strncmp( &buffer[offset], s2.buffer, s2.len ) == 0;
+	// An empty prefix never matches (Arduino behaviour)
+	if (!buffer || prefix.isEmpty()) return 0;
+	if (offset > len || prefix.length() > len - offset) return 0;
+	return memcmp(&buffer[offset], prefix.data(), prefix.length()) == 0;
 }
 
-unsigned char String::endsWith( const String &s2 ) const
+unsigned char String::endsWith( StringView suffix ) const
 {
-	if ( len < s2.len || !buffer || !s2.buffer) return 0;
-	return strcmp(&buffer[len - s2.len], s2.buffer) == 0;
+	if (!buffer || suffix.isEmpty() || len < suffix.length()) return 0;
+	return memcmp(&buffer[len - suffix.length()], suffix.data(), suffix.length()) == 0;
 }
 
 /*********************************************/
@@ -503,7 +564,7 @@ void String::getBytes(unsigned char *buf, unsigned int bufsize, unsigned int ind
 	}
 	unsigned int n = bufsize - 1;
 	if (n > len - index) n = len - index;
-	strncpy((char *)buf, buffer + index, n);
+	memcpy(buf, buffer + index, n);
 	buf[n] = 0;
 }
 
@@ -519,22 +580,20 @@ int String::indexOf(char c) const
 int String::indexOf( char ch, unsigned int fromIndex ) const
 {
 	if (fromIndex >= len) return -1;
-	const char* temp = strchr(buffer + fromIndex, ch);
+	const char* temp = str_find_char(buffer + fromIndex, len - fromIndex, ch);
 	if (temp == NULL) return -1;
 	return temp - buffer;
 }
 
-int String::indexOf(const String &s2) const
+int String::indexOf(StringView s2) const
 {
 	return indexOf(s2, 0);
 }
 
-int String::indexOf(const String &s2, unsigned int fromIndex) const
+int String::indexOf(StringView s2, unsigned int fromIndex) const
 {
 	if (fromIndex >= len) return -1;
-	const char *found = strstr(buffer + fromIndex, s2.buffer);
-	if (found == NULL) return -1;
-	return found - buffer;
+	return view().find(s2, fromIndex);
 }
 
 int String::lastIndexOf( char theChar ) const
@@ -545,30 +604,22 @@ int String::lastIndexOf( char theChar ) const
 int String::lastIndexOf(char ch, unsigned int fromIndex) const
 {
 	if (fromIndex >= len) return -1;
-	char tempchar = buffer[fromIndex + 1];
-	buffer[fromIndex + 1] = '\0';
-	char* temp = strrchr( buffer, ch );
-	buffer[fromIndex + 1] = tempchar;
+	const char* temp = str_rfind_char(buffer, fromIndex + 1, ch);
 	if (temp == NULL) return -1;
 	return temp - buffer;
 }
 
-int String::lastIndexOf(const String &s2) const
+int String::lastIndexOf(StringView s2) const
 {
-	return lastIndexOf(s2, len - s2.len);
+	return lastIndexOf(s2, len);
 }
 
-int String::lastIndexOf(const String &s2, unsigned int fromIndex) const
+int String::lastIndexOf(StringView s2, unsigned int fromIndex) const
 {
-  	if (s2.len == 0 || len == 0 || s2.len > len) return -1;
-	if (fromIndex >= len) fromIndex = len - 1;
-	int found = -1;
-	for (char *p = buffer; p <= buffer + fromIndex; p++) {
-		p = strstr(p, s2.buffer);
-		if (!p) break;
-		if ((unsigned int)(p - buffer) <= fromIndex) found = p - buffer;
-	}
-	return found;
+	if (s2.length() == 0 || len == 0 || s2.length() > len) return -1;
+	// A match can start no later than fromIndex, nor run past the end
+	if (fromIndex > len - s2.length()) fromIndex = len - s2.length();
+	return view(0, fromIndex + s2.length()).rfind(s2);
 }
 
 String String::substring(unsigned int left, unsigned int right) const
@@ -595,52 +646,68 @@ String String::substring(unsigned int left, unsigned int right) const
 void String::replace(char find, char replace)
 {
 	if (!buffer) return;
-	for (char *p = buffer; *p; p++) {
-		if (*p == find) *p = replace;
-	}
+	str_replace_char(buffer, len, find, replace);
 }
 
-void String::replace(const String& find, const String& replace)
+void String::replace(StringView find, StringView replace)
 {
-	if (len == 0 || find.len == 0) return;
-	int diff = replace.len - find.len;
-	char *readFrom = buffer;
-	char *foundAt;
-	if (diff == 0) {
-		while ((foundAt = strstr(readFrom, find.buffer)) != NULL) {
-			memcpy(foundAt, replace.buffer, replace.len);
-			readFrom = foundAt + replace.len;
-		}
-	} else if (diff < 0) {
-		char *writeTo = buffer;
-		while ((foundAt = strstr(readFrom, find.buffer)) != NULL) {
-			unsigned int n = foundAt - readFrom;
-			memcpy(writeTo, readFrom, n);
-			writeTo += n;
-			memcpy(writeTo, replace.buffer, replace.len);
-			writeTo += replace.len;
-			readFrom = foundAt + find.len;
-			len += diff;
-		}
-		strcpy(writeTo, readFrom);
-	} else {
-		unsigned int size = len; // compute size needed for result
-		while ((foundAt = strstr(readFrom, find.buffer)) != NULL) {
-			readFrom = foundAt + find.len;
-			size += diff;
+	if (len == 0 || find.length() == 0) return;
+	// The arguments may point into this string, which is rewritten below
+	if ((find.data() >= buffer && find.data() <= buffer + len) ||
+		(replace.data() >= buffer && replace.data() <= buffer + len)) {
+		String findCopy(find), replaceCopy(replace);
+		this->replace(findCopy.view(), replaceCopy.view());
+		return;
+	}
+	const unsigned int findLen = find.length();
+	const unsigned int replaceLen = replace.length();
+
+	if (findLen == replaceLen) {
+		const char *end = buffer + len;
+		char *foundAt = buffer;
+		while ((foundAt = (char *)str_find(foundAt, end - foundAt, find.data(), findLen)) != NULL) {
+			memcpy(foundAt, replace.data(), replaceLen);
+			foundAt += findLen;
 		}
-		if (size == len) return;
-		if (size > capacity && !changeBuffer(size)) return;
-		int index = len - 1;
-		while (index >= 0 && (index = lastIndexOf(find, index)) >= 0) {
-			readFrom = buffer + index + find.len;
-			memmove(readFrom + diff, readFrom, len - (readFrom - buffer));
-			len += diff;
-			buffer[len] = 0;
-			memcpy(buffer + index, replace.buffer, replace.len);
-			index--;
+		return;
+	}
+
+	// Growing: count matches so the buffer is resized once, then shift the
+	// text to the end of the new buffer. Either way the rewrite below is a
+	// single left-to-right pass in which the write position never passes
+	// the read position, so every byte moves at most once more.
+	unsigned int shift = 0;
+	if (replaceLen > findLen) {
+		unsigned int count = 0;
+		const char *end = buffer + len;
+		const char *at = buffer;
+		while ((at = str_find(at, end - at, find.data(), findLen)) != NULL) {
+			count++;
+			at += findLen;
 		}
+		if (count == 0) return;
+		shift = count * (replaceLen - findLen);
+		if (len + shift > capacity && !changeBuffer(len + shift)) return;
+		memmove(buffer + shift, buffer, len);
+	}
+
+	const char *readFrom = buffer + shift;
+	const char *end = buffer + shift + len;
+	char *writeTo = buffer;
+	const char *foundAt;
+	while ((foundAt = str_find(readFrom, end - readFrom, find.data(), findLen)) != NULL) {
+		unsigned int n = foundAt - readFrom;
+		memmove(writeTo, readFrom, n);
+		writeTo += n;
+		memcpy(writeTo, replace.data(), replaceLen);
+		writeTo += replaceLen;
+		readFrom = foundAt + findLen;
 	}
+	unsigned int n = end - readFrom;
+	memmove(writeTo, readFrom, n);
+	writeTo += n;
+	len = writeTo - buffer;
+	buffer[len] = 0;
 }
 
 void String::remove(unsigned int index){
@@ -656,24 +723,20 @@ void String::remove(unsigned int index, unsigned int count){
 	if (count > len - index) { count = len - index; }
 	char *writeTo = buffer + index;
 	len = len - count;
-	strncpy(writeTo, buffer + index + count,len - index);
+	memmove(writeTo, buffer + index + count, len - index);
 	buffer[len] = 0;
 }
 
 void String::toLowerCase(void)
 {
 	if (!buffer) return;
-	for (char *p = buffer; *p; p++) {
-		*p = tolower(*p);
-	}
+	str_to_lower(buffer, len);
 }
 
 void String::toUpperCase(void)
 {
 	if (!buffer) return;
-	for (char *p = buffer; *p; p++) {
-		*p = toupper(*p);
-	}
+	str_to_upper(buffer, len);
 }
 
 void String::trim(void)
@@ -694,18 +757,16 @@ void String::trim(void)
 
 long String::toInt(void) const
 {
-	if (buffer) return atol(buffer);
-	return 0;
+	return view().toInt();
 }
 
 float String::toFloat(void) const
 {
-	return float(toDouble());
+	return view().toFloat();
 }
 
 double String::toDouble(void) const
 {
-	if (buffer) return atof(buffer);
-	return 0;
+	return view().toDouble();
 }
 
@@ -0,0 +1,160 @@
+#include "WStringView.h"
+#include "WString.h"
+#include "str_kernels.h"
+
+#include <ctype.h>
+
+/*********************************************/
+/*  Slicing                                  */
+/*********************************************/
+
+StringView StringView::substring(unsigned int left, unsigned int right) const
+{
+	if (left > right) {
+		unsigned int temp = right;
+		right = left;
+		left = temp;
+	}
+	if (left >= len) return StringView();
+	if (right > len) right = len;
+	return StringView(ptr + left, right - left);
+}
+
+StringView StringView::trim(void) const
+{
+	unsigned int begin = 0;
+	unsigned int end = len;
+	while (begin < end && isspace((unsigned char)ptr[begin])) begin++;
+	while (end > begin && isspace((unsigned char)ptr[end - 1])) end--;
+	return StringView(ptr + begin, end - begin);
+}
+
+StringView StringView::split(char delim)
+{
+	int at = find(delim);
+	if (at < 0) {
+		StringView token = *this;
+		*this = StringView();
+		return token;
+	}
+	StringView token(ptr, at);
+	ptr += at + 1;
+	len -= at + 1;
+	return token;
+}
+
+StringView StringView::nextWord(void)
+{
+	unsigned int begin = 0;
+	while (begin < len && isspace((unsigned char)ptr[begin])) begin++;
+	unsigned int end = begin;
+	while (end < len && !isspace((unsigned char)ptr[end])) end++;
+	StringView token(ptr + begin, end - begin);
+	ptr += end;
+	len -= end;
+	return token;
+}
+
+/*********************************************/
+/*  Search                                   */
+/*********************************************/
+
+int StringView::find(char ch, unsigned int fromIndex) const
+{
+	if (fromIndex >= len) return -1;
+	const char *found = str_find_char(ptr + fromIndex, len - fromIndex, ch);
+	if (found == NULL) return -1;
+	return found - ptr;
+}
+
+int StringView::find(StringView str, unsigned int fromIndex) const
+{
+	if (fromIndex > len) return -1;
+	if (str.len == 0) return fromIndex;
+	const char *found = str_find(ptr + fromIndex, len - fromIndex, str.ptr, str.len);
+	if (found == NULL) return -1;
+	return found - ptr;
+}
+
+int StringView::rfind(char ch) const
+{
+	const char *found = str_rfind_char(ptr, len, ch);
+	if (found == NULL) return -1;
+	return found - ptr;
+}
+
+int StringView::rfind(StringView str) const
+{
+	if (str.len == 0) return len;
+	const char *found = str_rfind(ptr, len, str.ptr, str.len);
+	if (found == NULL) return -1;
+	return found - ptr;
+}
+
+/*********************************************/
+/*  Comparison                               */
+/*********************************************/
+
+bool StringView::equals(StringView other) const
+{
+	return len == other.len && (len == 0 || memcmp(ptr, other.ptr, len) == 0);
+}
+
+bool StringView::equalsIgnoreCase(StringView other) const
+{
+	return len == other.len && str_equals_ignore_case(ptr, other.ptr, len);
+}
+
+int StringView::compareTo(StringView other) const
+{
+	unsigned int n = len < other.len ? len : other.len;
+	int diff = n ? memcmp(ptr, other.ptr, n) : 0;
+	if (diff != 0) return diff;
+	if (len == other.len) return 0;
+	return len < other.len ? -1 : 1;
+}
+
+bool StringView::startsWith(StringView prefix) const
+{
+	return prefix.len <= len && (prefix.len == 0 || memcmp(ptr, prefix.ptr, prefix.len) == 0);
+}
+
+bool StringView::endsWith(StringView suffix) const
+{
+	return suffix.len <= len &&
+		(suffix.len == 0 || memcmp(ptr + len - suffix.len, suffix.ptr, suffix.len) == 0);
+}
+
+/*********************************************/
+/*  Parsing / Conversion                     */
+/*********************************************/
+
+// Lenient conversions in the spirit of atol()/atof(): leading whitespace
+// and trailing garbage are ignored and failures read as 0. The parsing
+// itself lives in num_parse.cpp; parse() exposes its status.
+
+long StringView::toInt(void) const
+{
+	long value;
+	num_parse_long(ptr, len, &value, NULL);
+	return value;
+}
+
+float StringView::toFloat(void) const
+{
+	float value;
+	num_parse_float(ptr, len, &value, NULL);
+	return value;
+}
+
+double StringView::toDouble(void) const
+{
+	double value;
+	num_parse_double(ptr, len, &value, NULL);
+	return value;
+}
+
+String StringView::toString(void) const
+{
+	return String(*this);
+}
@@ -36,6 +36,13 @@ extern void (*__init_array_end__[])(void);
 extern void (*__fini_array_start__[])(void);
 extern void (*__fini_array_end__[])(void);
 
+// Loop scheduling config - defined by APP_LOOP_CONFIG() in app code, if at all
+extern const struct AppLoopConfig app_loop_config __attribute__((weak));
+
+// Resident code region (APP_RESIDENT) - never paged out of SRAM
+extern char __resident_start__[];
+extern char __resident_end__[];
+
 // BSS verification marker - this MUST be in BSS and MUST be zero after zeroing
 // Kernel can check this to verify BSS zeroing worked
 static uint32_t __bss_verification_marker;
@@ -57,13 +64,18 @@ __attribute__((section(".app_hdr"), used)) struct {
   void (**init_array_end)(void);    // End of .init_array
   void (**fini_array_start)(void);  // Start of .fini_array (global destructors)
   void (**fini_array_end)(void);     // End of .fini_array
+  void* resident_start;      // Start of .resident (code callable from interrupts)
+  void* resident_end;        // End of .resident
+  const void* loop_config;   // AppLoopConfig, NULL keeps the 1 ms delay loop
 } __app_header = {
-  0x41505041u, 0x00020001u, app_setup, app_loop, 0,  // Version bumped for init_array support
+  0x41505041u, 0x00020003u, app_setup, app_loop, 0,  // Version bumped for loop scheduling config
   __data_start__, __data_end__,
   __bss_start__, __bss_end__,
   &__bss_verification_marker,
   __init_array_start__, __init_array_end__,
-  __fini_array_start__, __fini_array_end__
+  __fini_array_start__, __fini_array_end__,
+  __resident_start__, __resident_end__,
+  &app_loop_config
 };
 
 // Returns syscall gate pointer - app's syscall stubs call this
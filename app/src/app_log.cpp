@@ -0,0 +1,97 @@
+// Binary logger ring buffers - see app_log.h
+
+#include "app_log.h"
+
+#include "app_syscalls.h"
+#include "serial_tx.h"
+#include "app_critical.h"
+#include "gpio_fast.h"
+
+// First entry of .logfmt (the linker script places .logfmt.0 ahead of the
+// rest), used for the overflow record emitted by app_log_flush()
+static const char kDroppedFmt[] __attribute__((section(".logfmt.0"), used)) =
+    "<%u log records dropped>";
+
+// Used by its own core only, but on core 0 by every task there (AppTask,
+// app tasks, AppDefer handlers). head, tail and the counters change only
+// with interrupts masked. A flush sends [tail, head) straight from the
+// ring: records only go into the free space, which excludes that range
+// until tail moves, and `flushing` keeps a second flush out meanwhile.
+struct AppLogRing {
+    unsigned int head;  // next byte to write
+    unsigned int tail;  // next byte to send
+    uint32_t droppedSinceFlush;
+    uint32_t droppedTotal;
+    bool flushing;
+    uint8_t data[APP_LOG_RING_SIZE];
+};
+
+static AppLogRing g_log[2];
+
+static inline AppLogRing& currentRing() {
+    return g_log[app_core_num()];
+}
+
+// Runs masked, so it is resident and copies without memcpy
+extern "C" void APP_RESIDENT app_log_record(const uint8_t* record, unsigned int len) {
+    const uint32_t saved = app_critical_enter();
+    AppLogRing& ring = g_log[app_core_num()];
+    // One byte stays free so that head == tail always means empty
+    unsigned int used = (ring.head - ring.tail + APP_LOG_RING_SIZE) % APP_LOG_RING_SIZE;
+    if (len > APP_LOG_RING_SIZE - 1 - used) {
+        ring.droppedSinceFlush++;
+        ring.droppedTotal++;
+        app_critical_exit(saved);
+        return;
+    }
+    unsigned int first = APP_LOG_RING_SIZE - ring.head;
+    if (first > len) first = len;
+    app_critical_copy(ring.data + ring.head, record, first);
+    app_critical_copy(ring.data, record + first, len - first);
+    ring.head = (ring.head + len) % APP_LOG_RING_SIZE;
+    app_critical_exit(saved);
+}
+
+extern "C" void app_log_flush(void) {
+    AppLogRing& ring = currentRing();
+    // Keep the order of text and binary output on the wire
+    serial_tx_flush();
+
+    // A flush already in progress on this core (in a task we preempted)
+    // sends what is there
+    uint32_t saved = app_critical_enter();
+    if (ring.flushing) {
+        app_critical_exit(saved);
+        return;
+    }
+    ring.flushing = true;
+    const unsigned int head = ring.head;
+    unsigned int tail = ring.tail;
+    const uint32_t dropped = ring.droppedSinceFlush;
+    ring.droppedSinceFlush = 0;
+    app_critical_exit(saved);
+
+    if (head < tail) {
+        Serial_writeBuf(ring.data + tail, APP_LOG_RING_SIZE - tail);
+        tail = 0;
+    }
+    if (head != tail) {
+        Serial_writeBuf(ring.data + tail, head - tail);
+    }
+
+    saved = app_critical_enter();
+    ring.tail = head;
+    ring.flushing = false;
+    app_critical_exit(saved);
+
+    if (dropped != 0) {
+        app_log_detail::emit(kDroppedFmt, dropped);
+        // Usually the only record left; if it is dropped too, the count
+        // goes into the next overflow record
+        app_log_flush();
+    }
+}
+
+extern "C" uint32_t app_log_dropped(void) {
+    return currentRing().droppedTotal;
+}
@@ -0,0 +1,28 @@
+/* ===========================================================================
+ *  AUTO-GENERATED FILE - DO NOT EDIT unless you know what you're doing!!
+ *  ---------------------------------------------------------------------------
+ *  Generated by : syscall_gen.py                
+ *  Timestamp    : 2026-10-18 20:26:25 Local
+ *  File         : app_sys_raw.c
+ *  Source Hash:  556a0cda55662869                                            
+ *  This file is produced automatically during the build process.
+ *  Manual edits will be overwritten on the next regeneration.
+ * ===========================================================================
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uintptr_t (*Gate)(uint16_t, uintptr_t a0, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6, uintptr_t a7, uintptr_t a8, uintptr_t a9, uintptr_t a10, uintptr_t a11, uintptr_t a12, uintptr_t a13, uintptr_t a14, uintptr_t a15, uintptr_t a16, uintptr_t a17, uintptr_t a18, uintptr_t a19, uintptr_t a20, uintptr_t a21, uintptr_t a22, uintptr_t a23, uintptr_t a24, uintptr_t a25, uintptr_t a26, uintptr_t a27, uintptr_t a28, uintptr_t a29);
+Gate __syscall_gate_ptr(void);
+
+// Cached gate pointer - initialized on first call
+static Gate cached_gate = NULL;
+
+uintptr_t __syscall_raw(uint16_t id, uintptr_t a0, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6, uintptr_t a7, uintptr_t a8, uintptr_t a9, uintptr_t a10, uintptr_t a11, uintptr_t a12, uintptr_t a13, uintptr_t a14, uintptr_t a15, uintptr_t a16, uintptr_t a17, uintptr_t a18, uintptr_t a19, uintptr_t a20, uintptr_t a21, uintptr_t a22, uintptr_t a23, uintptr_t a24, uintptr_t a25, uintptr_t a26, uintptr_t a27, uintptr_t a28, uintptr_t a29) {
+  // Cache gate pointer on first call (optimization #1)
+  if (cached_gate == NULL) {{
+    cached_gate = __syscall_gate_ptr();
+  }}
+  // Direct call without NULL check (optimization #2: gate is guaranteed non-NULL after init)
+  return cached_gate(id, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+}
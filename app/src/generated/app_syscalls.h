@@ -0,0 +1,4589 @@
+/* ===========================================================================
+ *  AUTO-GENERATED FILE - DO NOT EDIT unless you know what you're doing!!
+ *  ---------------------------------------------------------------------------
+ *  Generated by : syscall_gen.py                
+ *  Timestamp    : 2026-10-18 20:26:25 Local
+ *  File         : app_syscalls.h
+ *  Source Hash:  556a0cda55662869                                            
+ *  This file is produced automatically during the build process.
+ *  Manual edits will be overwritten on the next regeneration.
+ * ===========================================================================
+ */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include "syscall_ids.h"
+extern "C" {
+uintptr_t __syscall_raw(uint16_t, uintptr_t a0, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6, uintptr_t a7, uintptr_t a8, uintptr_t a9, uintptr_t a10, uintptr_t a11, uintptr_t a12, uintptr_t a13, uintptr_t a14, uintptr_t a15, uintptr_t a16, uintptr_t a17, uintptr_t a18, uintptr_t a19, uintptr_t a20, uintptr_t a21, uintptr_t a22, uintptr_t a23, uintptr_t a24, uintptr_t a25, uintptr_t a26, uintptr_t a27, uintptr_t a28, uintptr_t a29);
+}
+
+static inline void pinMode(uint8_t pin, uint8_t mode) {
+  uintptr_t _p0 = static_cast<uintptr_t>(pin);
+  uintptr_t _p1 = static_cast<uintptr_t>(mode);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_pinMode, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void digitalWrite(uint8_t pin, uint8_t val) {
+  uintptr_t _p0 = static_cast<uintptr_t>(pin);
+  uintptr_t _p1 = static_cast<uintptr_t>(val);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_digitalWrite, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline int digitalRead(uint8_t pin) {
+  uintptr_t _p0 = static_cast<uintptr_t>(pin);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_digitalRead, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool gpio_claim(uint32_t mask) {
+  uintptr_t _p0 = static_cast<uintptr_t>(mask);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_gpio_claim, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void gpio_release(uint32_t mask) {
+  uintptr_t _p0 = static_cast<uintptr_t>(mask);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_gpio_release, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline uint32_t gpio_claimed() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_gpio_claimed, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void gpio_put_masked(uint32_t mask, uint32_t value) {
+  uintptr_t _p0 = static_cast<uintptr_t>(mask);
+  uintptr_t _p1 = static_cast<uintptr_t>(value);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_gpio_put_masked, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void gpio_set_dir_masked(uint32_t mask, uint32_t value) {
+  uintptr_t _p0 = static_cast<uintptr_t>(mask);
+  uintptr_t _p1 = static_cast<uintptr_t>(value);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_gpio_set_dir_masked, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline uint32_t gpio_get_all() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_gpio_get_all, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void delay(uint32_t ms) {
+  uintptr_t _p0 = static_cast<uintptr_t>(ms);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_delay, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void delayMicroseconds(unsigned int us) {
+  uintptr_t _p0 = static_cast<uintptr_t>(us);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_delayMicroseconds, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline uint32_t millis() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_millis, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t micros() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_micros, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int32_t Timer_startRepeating(uintptr_t callback, uint32_t period_us) {
+  uintptr_t _p0 = static_cast<uintptr_t>(callback);
+  uintptr_t _p1 = static_cast<uintptr_t>(period_us);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int32_t>(__syscall_raw(SYSC_Timer_startRepeating, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int32_t Timer_startOnce(uintptr_t callback, uint32_t delay_us) {
+  uintptr_t _p0 = static_cast<uintptr_t>(callback);
+  uintptr_t _p1 = static_cast<uintptr_t>(delay_us);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int32_t>(__syscall_raw(SYSC_Timer_startOnce, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void Timer_stop(int32_t handle) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Timer_stop, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline bool Timer_getStats(int32_t handle, uint32_t* stats) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(stats);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Timer_getStats, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool App_setLoopMode(uint32_t mode, uint32_t param) {
+  uintptr_t _p0 = static_cast<uintptr_t>(mode);
+  uintptr_t _p1 = static_cast<uintptr_t>(param);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_App_setLoopMode, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void App_loopWake() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_App_loopWake, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline bool App_getLoopStats(uint32_t* stats) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(stats);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_App_getLoopStats, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void App_resetLoopStats() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_App_resetLoopStats, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline int32_t Task_create(uintptr_t entry, uintptr_t arg, uint32_t stack_words, uint32_t priority) {
+  uintptr_t _p0 = static_cast<uintptr_t>(entry);
+  uintptr_t _p1 = static_cast<uintptr_t>(arg);
+  uintptr_t _p2 = static_cast<uintptr_t>(stack_words);
+  uintptr_t _p3 = static_cast<uintptr_t>(priority);
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int32_t>(__syscall_raw(SYSC_Task_create, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void Task_delete(int32_t handle) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Task_delete, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline bool Task_notifyGive(int32_t handle) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Task_notifyGive, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t Task_notifyTake(uint32_t timeout_ms) {
+  uintptr_t _p0 = static_cast<uintptr_t>(timeout_ms);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_Task_notifyTake, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int32_t Queue_create(uint32_t length, uint32_t item_size) {
+  uintptr_t _p0 = static_cast<uintptr_t>(length);
+  uintptr_t _p1 = static_cast<uintptr_t>(item_size);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int32_t>(__syscall_raw(SYSC_Queue_create, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void Queue_delete(int32_t handle) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Queue_delete, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline bool Queue_send(int32_t handle, const void* item, uint32_t timeout_ms) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(item);
+  uintptr_t _p2 = static_cast<uintptr_t>(timeout_ms);
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Queue_send, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool Queue_receive(int32_t handle, void* item, uint32_t timeout_ms) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(item);
+  uintptr_t _p2 = static_cast<uintptr_t>(timeout_ms);
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Queue_receive, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t Queue_count(int32_t handle) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_Queue_count, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int32_t Event_create() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int32_t>(__syscall_raw(SYSC_Event_create, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void Event_delete(int32_t handle) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Event_delete, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline uint32_t Event_set(int32_t handle, uint32_t bits) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = static_cast<uintptr_t>(bits);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_Event_set, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t Event_clear(int32_t handle, uint32_t bits) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = static_cast<uintptr_t>(bits);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_Event_clear, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t Event_wait(int32_t handle, uint32_t bits, uint32_t flags, uint32_t timeout_ms) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = static_cast<uintptr_t>(bits);
+  uintptr_t _p2 = static_cast<uintptr_t>(flags);
+  uintptr_t _p3 = static_cast<uintptr_t>(timeout_ms);
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_Event_wait, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool Cache_pin(uintptr_t addr) {
+  uintptr_t _p0 = static_cast<uintptr_t>(addr);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Cache_pin, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void Cache_unpin(uintptr_t addr) {
+  uintptr_t _p0 = static_cast<uintptr_t>(addr);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Cache_unpin, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline bool Cache_setPartition(uint32_t core0_slots) {
+  uintptr_t _p0 = static_cast<uintptr_t>(core0_slots);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Cache_setPartition, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool Cache_getStats(uint32_t core, uint32_t* stats) {
+  uintptr_t _p0 = static_cast<uintptr_t>(core);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(stats);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Cache_getStats, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int analogRead(uint8_t pin) {
+  uintptr_t _p0 = static_cast<uintptr_t>(pin);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_analogRead, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void analogWrite(uint8_t pin, int value) {
+  uintptr_t _p0 = static_cast<uintptr_t>(pin);
+  uintptr_t _p1 = static_cast<uintptr_t>(value);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_analogWrite, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline bool ADC_startStream(uint32_t channels_mask, uint32_t rate, uint16_t* buf, size_t len) {
+  uintptr_t _p0 = static_cast<uintptr_t>(channels_mask);
+  uintptr_t _p1 = static_cast<uintptr_t>(rate);
+  uintptr_t _p2 = reinterpret_cast<uintptr_t>(buf);
+  uintptr_t _p3 = static_cast<uintptr_t>(len);
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_ADC_startStream, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void ADC_stopStream() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_ADC_stopStream, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline uint32_t ADC_streamPoll() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_ADC_streamPoll, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t ADC_streamOverruns() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_ADC_streamOverruns, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool EdgeCapture_start(uint32_t pin_mask, uint32_t edges) {
+  uintptr_t _p0 = static_cast<uintptr_t>(pin_mask);
+  uintptr_t _p1 = static_cast<uintptr_t>(edges);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_EdgeCapture_start, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void EdgeCapture_stop() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_EdgeCapture_stop, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline uint32_t EdgeCapture_read(void* records, uint32_t max_records) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(records);
+  uintptr_t _p1 = static_cast<uintptr_t>(max_records);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_EdgeCapture_read, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t EdgeCapture_overruns() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_EdgeCapture_overruns, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t EdgeCapture_clockHz() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_EdgeCapture_clockHz, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int32_t Pio_load(const void* program) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(program);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int32_t>(__syscall_raw(SYSC_Pio_load, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void Pio_unload(int32_t program) {
+  uintptr_t _p0 = static_cast<uintptr_t>(program);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Pio_unload, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline int32_t Pio_smInit(int32_t program, const void* config) {
+  uintptr_t _p0 = static_cast<uintptr_t>(program);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(config);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int32_t>(__syscall_raw(SYSC_Pio_smInit, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void Pio_smRelease(int32_t sm) {
+  uintptr_t _p0 = static_cast<uintptr_t>(sm);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Pio_smRelease, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void Pio_smEnable(int32_t sm, bool enable) {
+  uintptr_t _p0 = static_cast<uintptr_t>(sm);
+  uintptr_t _p1 = static_cast<uintptr_t>(enable);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Pio_smEnable, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void Pio_smExec(int32_t sm, uint32_t instruction) {
+  uintptr_t _p0 = static_cast<uintptr_t>(sm);
+  uintptr_t _p1 = static_cast<uintptr_t>(instruction);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Pio_smExec, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline uint32_t Pio_put(int32_t sm, const uint32_t* data, uint32_t count, uint32_t timeout_ms) {
+  uintptr_t _p0 = static_cast<uintptr_t>(sm);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(data);
+  uintptr_t _p2 = static_cast<uintptr_t>(count);
+  uintptr_t _p3 = static_cast<uintptr_t>(timeout_ms);
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_Pio_put, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t Pio_get(int32_t sm, uint32_t* data, uint32_t count, uint32_t timeout_ms) {
+  uintptr_t _p0 = static_cast<uintptr_t>(sm);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(data);
+  uintptr_t _p2 = static_cast<uintptr_t>(count);
+  uintptr_t _p3 = static_cast<uintptr_t>(timeout_ms);
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_Pio_get, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool Pio_dmaPut(int32_t sm, const void* data, uint32_t count, uint32_t size) {
+  uintptr_t _p0 = static_cast<uintptr_t>(sm);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(data);
+  uintptr_t _p2 = static_cast<uintptr_t>(count);
+  uintptr_t _p3 = static_cast<uintptr_t>(size);
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Pio_dmaPut, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool Pio_dmaGet(int32_t sm, void* data, uint32_t count, uint32_t size) {
+  uintptr_t _p0 = static_cast<uintptr_t>(sm);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(data);
+  uintptr_t _p2 = static_cast<uintptr_t>(count);
+  uintptr_t _p3 = static_cast<uintptr_t>(size);
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Pio_dmaGet, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool Pio_dmaBusy(int32_t sm) {
+  uintptr_t _p0 = static_cast<uintptr_t>(sm);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Pio_dmaBusy, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void Serial_begin(unsigned long baud) {
+  uintptr_t _p0 = static_cast<uintptr_t>(baud);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Serial_begin, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline size_t Serial_write_b(uint8_t b) {
+  uintptr_t _p0 = static_cast<uintptr_t>(b);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<size_t>(__syscall_raw(SYSC_Serial_write_b, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int Serial_available() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_Serial_available, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int Serial_read() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_Serial_read, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int Serial_peek() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_Serial_peek, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void Serial_flush() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Serial_flush, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline size_t Serial_print_s(const char* s) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(s);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<size_t>(__syscall_raw(SYSC_Serial_print_s, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline size_t Serial_println_s(const char* s) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(s);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<size_t>(__syscall_raw(SYSC_Serial_println_s, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline size_t Serial_println() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<size_t>(__syscall_raw(SYSC_Serial_println, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline size_t Serial_writeBuf(const uint8_t* buf, size_t length) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(buf);
+  uintptr_t _p1 = static_cast<uintptr_t>(length);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<size_t>(__syscall_raw(SYSC_Serial_writeBuf, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline size_t Serial_readBuf(uint8_t* buf, size_t length, uint32_t timeout) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(buf);
+  uintptr_t _p1 = static_cast<uintptr_t>(length);
+  uintptr_t _p2 = static_cast<uintptr_t>(timeout);
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<size_t>(__syscall_raw(SYSC_Serial_readBuf, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline size_t Serial_readUntil(uint8_t* buf, size_t length, uint8_t delim, uint32_t timeout) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(buf);
+  uintptr_t _p1 = static_cast<uintptr_t>(length);
+  uintptr_t _p2 = static_cast<uintptr_t>(delim);
+  uintptr_t _p3 = static_cast<uintptr_t>(timeout);
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<size_t>(__syscall_raw(SYSC_Serial_readUntil, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void SPI_begin() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_SPI_begin, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void SPI_end() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_SPI_end, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void SPI_beginTransaction(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) {
+  uintptr_t _p0 = static_cast<uintptr_t>(clock);
+  uintptr_t _p1 = static_cast<uintptr_t>(bitOrder);
+  uintptr_t _p2 = static_cast<uintptr_t>(dataMode);
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_SPI_beginTransaction, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void SPI_endTransaction() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_SPI_endTransaction, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline uint8_t SPI_transfer(uint8_t data) {
+  uintptr_t _p0 = static_cast<uintptr_t>(data);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint8_t>(__syscall_raw(SYSC_SPI_transfer, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void SPI_transferBuf(const uint8_t* tx, uint8_t* rx, size_t len) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(tx);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(rx);
+  uintptr_t _p2 = static_cast<uintptr_t>(len);
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_SPI_transferBuf, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void SPI_writeBuf(const uint8_t* data, size_t len) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(data);
+  uintptr_t _p1 = static_cast<uintptr_t>(len);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_SPI_writeBuf, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline uint32_t SPI_transferAsync(const uint8_t* tx, uint8_t* rx, size_t len) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(tx);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(rx);
+  uintptr_t _p2 = static_cast<uintptr_t>(len);
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_SPI_transferAsync, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool SPI_asyncDone(uint32_t handle) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handle);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_SPI_asyncDone, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void Wire_begin() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Wire_begin, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void Wire_end() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Wire_end, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void Wire_beginTransmission(uint8_t address) {
+  uintptr_t _p0 = static_cast<uintptr_t>(address);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Wire_beginTransmission, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline uint8_t Wire_endTransmission() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint8_t>(__syscall_raw(SYSC_Wire_endTransmission, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline size_t Wire_requestFrom(uint8_t address, size_t quantity) {
+  uintptr_t _p0 = static_cast<uintptr_t>(address);
+  uintptr_t _p1 = static_cast<uintptr_t>(quantity);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<size_t>(__syscall_raw(SYSC_Wire_requestFrom, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline size_t Wire_write_b(uint8_t data) {
+  uintptr_t _p0 = static_cast<uintptr_t>(data);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<size_t>(__syscall_raw(SYSC_Wire_write_b, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline size_t Wire_write_buf(const uint8_t* data, size_t length) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(data);
+  uintptr_t _p1 = static_cast<uintptr_t>(length);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<size_t>(__syscall_raw(SYSC_Wire_write_buf, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int Wire_available() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_Wire_available, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int Wire_read() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_Wire_read, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int32_t Wire_readBuf(uint8_t address, uint8_t reg, uint8_t* buf, size_t length) {
+  uintptr_t _p0 = static_cast<uintptr_t>(address);
+  uintptr_t _p1 = static_cast<uintptr_t>(reg);
+  uintptr_t _p2 = reinterpret_cast<uintptr_t>(buf);
+  uintptr_t _p3 = static_cast<uintptr_t>(length);
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int32_t>(__syscall_raw(SYSC_Wire_readBuf, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int32_t Wire_writeReg(uint8_t address, uint8_t reg, const uint8_t* data, size_t length) {
+  uintptr_t _p0 = static_cast<uintptr_t>(address);
+  uintptr_t _p1 = static_cast<uintptr_t>(reg);
+  uintptr_t _p2 = reinterpret_cast<uintptr_t>(data);
+  uintptr_t _p3 = static_cast<uintptr_t>(length);
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int32_t>(__syscall_raw(SYSC_Wire_writeReg, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool Wire_readBufAsync(uint8_t address, uint8_t reg, uint8_t* buf, size_t length, volatile int32_t* status) {
+  uintptr_t _p0 = static_cast<uintptr_t>(address);
+  uintptr_t _p1 = static_cast<uintptr_t>(reg);
+  uintptr_t _p2 = reinterpret_cast<uintptr_t>(buf);
+  uintptr_t _p3 = static_cast<uintptr_t>(length);
+  uintptr_t _p4 = reinterpret_cast<uintptr_t>(status);
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Wire_readBufAsync, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool Wire_writeRegAsync(uint8_t address, uint8_t reg, const uint8_t* data, size_t length, volatile int32_t* status) {
+  uintptr_t _p0 = static_cast<uintptr_t>(address);
+  uintptr_t _p1 = static_cast<uintptr_t>(reg);
+  uintptr_t _p2 = reinterpret_cast<uintptr_t>(data);
+  uintptr_t _p3 = static_cast<uintptr_t>(length);
+  uintptr_t _p4 = reinterpret_cast<uintptr_t>(status);
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Wire_writeRegAsync, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void multicore_reset_core1() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_multicore_reset_core1, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void multicore_launch_core1(uintptr_t entry) {
+  uintptr_t _p0 = static_cast<uintptr_t>(entry);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_multicore_launch_core1, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void multicore_fifo_push_blocking(uint32_t data) {
+  uintptr_t _p0 = static_cast<uintptr_t>(data);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_multicore_fifo_push_blocking, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline uint32_t multicore_fifo_pop_blocking() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_multicore_fifo_pop_blocking, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool multicore_fifo_rvalid() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_multicore_fifo_rvalid, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool multicore_fifo_wready() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_multicore_fifo_wready, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool bootselButton() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_bootselButton, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void softwareReset() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_softwareReset, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void attachInterrupt(uint8_t pin, uintptr_t isr, int mode) {
+  uintptr_t _p0 = static_cast<uintptr_t>(pin);
+  uintptr_t _p1 = static_cast<uintptr_t>(isr);
+  uintptr_t _p2 = static_cast<uintptr_t>(mode);
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_attachInterrupt, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void detachInterrupt(uint8_t pin) {
+  uintptr_t _p0 = static_cast<uintptr_t>(pin);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_detachInterrupt, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void attachInterruptDeferred(uint8_t pin, uintptr_t handler, int mode) {
+  uintptr_t _p0 = static_cast<uintptr_t>(pin);
+  uintptr_t _p1 = static_cast<uintptr_t>(handler);
+  uintptr_t _p2 = static_cast<uintptr_t>(mode);
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_attachInterruptDeferred, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline bool Defer_post(uintptr_t handler, uint32_t arg) {
+  uintptr_t _p0 = static_cast<uintptr_t>(handler);
+  uintptr_t _p1 = static_cast<uintptr_t>(arg);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Defer_post, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool Defer_getStats(uint32_t* stats) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(stats);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_Defer_getStats, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void Defer_resetStats() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_Defer_resetStats, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline int WiFi_begin(const char* ssid, const char* password) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(ssid);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(password);
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_WiFi_begin, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int WiFi_begin_open(const char* ssid) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(ssid);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_WiFi_begin_open, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int WiFi_status() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_WiFi_status, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int WiFi_disconnect() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_WiFi_disconnect, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t WiFi_localIP() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_WiFi_localIP, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t WiFi_subnetMask() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_WiFi_subnetMask, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint32_t WiFi_gatewayIP() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<uint32_t>(__syscall_raw(SYSC_WiFi_gatewayIP, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline const char* WiFi_SSID() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return reinterpret_cast<const char*>(__syscall_raw(SYSC_WiFi_SSID, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int32_t WiFi_RSSI() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int32_t>(__syscall_raw(SYSC_WiFi_RSSI, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline uint8_t* WiFi_macAddress(uint8_t* mac) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(mac);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return reinterpret_cast<uint8_t*>(__syscall_raw(SYSC_WiFi_macAddress, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline int WiFi_hostname(const char* hostname) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(hostname);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<int>(__syscall_raw(SYSC_WiFi_hostname, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline const char* WiFi_getHostname() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return reinterpret_cast<const char*>(__syscall_raw(SYSC_WiFi_getHostname, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool BLE_begin() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_BLE_begin, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void BLE_end() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_BLE_end, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void BLE_advertise() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_BLE_advertise, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void BLE_stopAdvertise() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_BLE_stopAdvertise, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void BLE_setAdvertisedServiceData(uint16_t uuid, const uint8_t* data, uint8_t length) {
+  uintptr_t _p0 = static_cast<uintptr_t>(uuid);
+  uintptr_t _p1 = reinterpret_cast<uintptr_t>(data);
+  uintptr_t _p2 = static_cast<uintptr_t>(length);
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_BLE_setAdvertisedServiceData, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void BLE_setAdvertisedServiceUuid(const char* uuid) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(uuid);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_BLE_setAdvertisedServiceUuid, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline void BLE_setLocalName(const char* name) {
+  uintptr_t _p0 = reinterpret_cast<uintptr_t>(name);
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_BLE_setLocalName, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline bool BLE_available() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_BLE_available, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool BLE_central() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_BLE_central, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline bool BLE_connected() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return static_cast<bool>(__syscall_raw(SYSC_BLE_connected, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
+static inline void BLE_disconnect() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  __syscall_raw(SYSC_BLE_disconnect, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29);
+  return;
+}
+
+static inline const char* BLE_address() {
+  uintptr_t _p0 = 0;
+  uintptr_t _p1 = 0;
+  uintptr_t _p2 = 0;
+  uintptr_t _p3 = 0;
+  uintptr_t _p4 = 0;
+  uintptr_t _p5 = 0;
+  uintptr_t _p6 = 0;
+  uintptr_t _p7 = 0;
+  uintptr_t _p8 = 0;
+  uintptr_t _p9 = 0;
+  uintptr_t _p10 = 0;
+  uintptr_t _p11 = 0;
+  uintptr_t _p12 = 0;
+  uintptr_t _p13 = 0;
+  uintptr_t _p14 = 0;
+  uintptr_t _p15 = 0;
+  uintptr_t _p16 = 0;
+  uintptr_t _p17 = 0;
+  uintptr_t _p18 = 0;
+  uintptr_t _p19 = 0;
+  uintptr_t _p20 = 0;
+  uintptr_t _p21 = 0;
+  uintptr_t _p22 = 0;
+  uintptr_t _p23 = 0;
+  uintptr_t _p24 = 0;
+  uintptr_t _p25 = 0;
+  uintptr_t _p26 = 0;
+  uintptr_t _p27 = 0;
+  uintptr_t _p28 = 0;
+  uintptr_t _p29 = 0;
+  return reinterpret_cast<const char*>(__syscall_raw(SYSC_BLE_address, _p0, _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10, _p11, _p12, _p13, _p14, _p15, _p16, _p17, _p18, _p19, _p20, _p21, _p22, _p23, _p24, _p25, _p26, _p27, _p28, _p29));
+}
+
@@ -0,0 +1,18 @@
+// Generated by tools/pio_asm.py from app/pio/*.pio - do not edit
+#pragma once
+
+#include "pio_program.h"
+
+// ws2812.pio: ws2812
+static APP_RESIDENT_CONST const uint16_t ws2812_program_instructions[] = {
+    0x6221,  //  0: out x, 1       side 0 [T3 - 1]  .wrap_target
+    0x1123,  //  1: jmp !x do_zero side 1 [T1 - 1]
+    0x1400,  //  2: jmp  bitloop   side 1 [T2 - 1]
+    0xa442,  //  3: nop            side 0 [T2 - 1]  .wrap
+};
+static APP_RESIDENT_CONST const PioProgram ws2812_program = {
+    ws2812_program_instructions, 4, -1, 0, 3, 1, 0, 0
+};
+#define ws2812_T1 2
+#define ws2812_T2 5
+#define ws2812_T3 3
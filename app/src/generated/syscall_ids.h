@@ -0,0 +1,148 @@
+/* ===========================================================================
+ *  AUTO-GENERATED FILE - DO NOT EDIT unless you know what you're doing!!
+ *  ---------------------------------------------------------------------------
+ *  Generated by : syscall_gen.py                
+ *  Timestamp    : 2026-10-18 20:26:25 Local
+ *  File         : syscall_ids.h
+ *  Source Hash:  556a0cda55662869                                            
+ *  This file is produced automatically during the build process.
+ *  Manual edits will be overwritten on the next regeneration.
+ * ===========================================================================
+ */
+#pragma once
+enum : unsigned {
+  SYSC_pinMode = 0,
+  SYSC_digitalWrite = 1,
+  SYSC_digitalRead = 2,
+  SYSC_gpio_claim = 3,
+  SYSC_gpio_release = 4,
+  SYSC_gpio_claimed = 5,
+  SYSC_gpio_put_masked = 6,
+  SYSC_gpio_set_dir_masked = 7,
+  SYSC_gpio_get_all = 8,
+  SYSC_delay = 9,
+  SYSC_delayMicroseconds = 10,
+  SYSC_millis = 11,
+  SYSC_micros = 12,
+  SYSC_Timer_startRepeating = 13,
+  SYSC_Timer_startOnce = 14,
+  SYSC_Timer_stop = 15,
+  SYSC_Timer_getStats = 16,
+  SYSC_App_setLoopMode = 17,
+  SYSC_App_loopWake = 18,
+  SYSC_App_getLoopStats = 19,
+  SYSC_App_resetLoopStats = 20,
+  SYSC_Task_create = 21,
+  SYSC_Task_delete = 22,
+  SYSC_Task_notifyGive = 23,
+  SYSC_Task_notifyTake = 24,
+  SYSC_Queue_create = 25,
+  SYSC_Queue_delete = 26,
+  SYSC_Queue_send = 27,
+  SYSC_Queue_receive = 28,
+  SYSC_Queue_count = 29,
+  SYSC_Event_create = 30,
+  SYSC_Event_delete = 31,
+  SYSC_Event_set = 32,
+  SYSC_Event_clear = 33,
+  SYSC_Event_wait = 34,
+  SYSC_Cache_pin = 35,
+  SYSC_Cache_unpin = 36,
+  SYSC_Cache_setPartition = 37,
+  SYSC_Cache_getStats = 38,
+  SYSC_analogRead = 39,
+  SYSC_analogWrite = 40,
+  SYSC_ADC_startStream = 41,
+  SYSC_ADC_stopStream = 42,
+  SYSC_ADC_streamPoll = 43,
+  SYSC_ADC_streamOverruns = 44,
+  SYSC_EdgeCapture_start = 45,
+  SYSC_EdgeCapture_stop = 46,
+  SYSC_EdgeCapture_read = 47,
+  SYSC_EdgeCapture_overruns = 48,
+  SYSC_EdgeCapture_clockHz = 49,
+  SYSC_Pio_load = 50,
+  SYSC_Pio_unload = 51,
+  SYSC_Pio_smInit = 52,
+  SYSC_Pio_smRelease = 53,
+  SYSC_Pio_smEnable = 54,
+  SYSC_Pio_smExec = 55,
+  SYSC_Pio_put = 56,
+  SYSC_Pio_get = 57,
+  SYSC_Pio_dmaPut = 58,
+  SYSC_Pio_dmaGet = 59,
+  SYSC_Pio_dmaBusy = 60,
+  SYSC_Serial_begin = 61,
+  SYSC_Serial_write_b = 62,
+  SYSC_Serial_available = 63,
+  SYSC_Serial_read = 64,
+  SYSC_Serial_peek = 65,
+  SYSC_Serial_flush = 66,
+  SYSC_Serial_print_s = 67,
+  SYSC_Serial_println_s = 68,
+  SYSC_Serial_println = 69,
+  SYSC_Serial_writeBuf = 70,
+  SYSC_Serial_readBuf = 71,
+  SYSC_Serial_readUntil = 72,
+  SYSC_SPI_begin = 73,
+  SYSC_SPI_end = 74,
+  SYSC_SPI_beginTransaction = 75,
+  SYSC_SPI_endTransaction = 76,
+  SYSC_SPI_transfer = 77,
+  SYSC_SPI_transferBuf = 78,
+  SYSC_SPI_writeBuf = 79,
+  SYSC_SPI_transferAsync = 80,
+  SYSC_SPI_asyncDone = 81,
+  SYSC_Wire_begin = 82,
+  SYSC_Wire_end = 83,
+  SYSC_Wire_beginTransmission = 84,
+  SYSC_Wire_endTransmission = 85,
+  SYSC_Wire_requestFrom = 86,
+  SYSC_Wire_write_b = 87,
+  SYSC_Wire_write_buf = 88,
+  SYSC_Wire_available = 89,
+  SYSC_Wire_read = 90,
+  SYSC_Wire_readBuf = 91,
+  SYSC_Wire_writeReg = 92,
+  SYSC_Wire_readBufAsync = 93,
+  SYSC_Wire_writeRegAsync = 94,
+  SYSC_multicore_reset_core1 = 95,
+  SYSC_multicore_launch_core1 = 96,
+  SYSC_multicore_fifo_push_blocking = 97,
+  SYSC_multicore_fifo_pop_blocking = 98,
+  SYSC_multicore_fifo_rvalid = 99,
+  SYSC_multicore_fifo_wready = 100,
+  SYSC_bootselButton = 101,
+  SYSC_softwareReset = 102,
+  SYSC_attachInterrupt = 103,
+  SYSC_detachInterrupt = 104,
+  SYSC_attachInterruptDeferred = 105,
+  SYSC_Defer_post = 106,
+  SYSC_Defer_getStats = 107,
+  SYSC_Defer_resetStats = 108,
+  SYSC_WiFi_begin = 109,
+  SYSC_WiFi_begin_open = 110,
+  SYSC_WiFi_status = 111,
+  SYSC_WiFi_disconnect = 112,
+  SYSC_WiFi_localIP = 113,
+  SYSC_WiFi_subnetMask = 114,
+  SYSC_WiFi_gatewayIP = 115,
+  SYSC_WiFi_SSID = 116,
+  SYSC_WiFi_RSSI = 117,
+  SYSC_WiFi_macAddress = 118,
+  SYSC_WiFi_hostname = 119,
+  SYSC_WiFi_getHostname = 120,
+  SYSC_BLE_begin = 121,
+  SYSC_BLE_end = 122,
+  SYSC_BLE_advertise = 123,
+  SYSC_BLE_stopAdvertise = 124,
+  SYSC_BLE_setAdvertisedServiceData = 125,
+  SYSC_BLE_setAdvertisedServiceUuid = 126,
+  SYSC_BLE_setLocalName = 127,
+  SYSC_BLE_available = 128,
+  SYSC_BLE_central = 129,
+  SYSC_BLE_connected = 130,
+  SYSC_BLE_disconnect = 131,
+  SYSC_BLE_address = 132,
+  SYSC__COUNT = 133
+};
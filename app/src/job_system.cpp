@@ -0,0 +1,216 @@
+// Work-stealing job system - see job_system.h
+//
+// Everything core 1 can reach is APP_RESIDENT: the worker loop, the deque
+// operations and the public entry points (jobs may submit and wait too).
+
+#include "job_system.h"
+
+#include "app_syscalls.h"
+#include "gpio_fast.h"
+
+#define JOB_INBOX_SIZE 8  // non-resident jobs submitted on core 1
+
+static_assert((JOB_DEQUE_SIZE & (JOB_DEQUE_SIZE - 1)) == 0, "JOB_DEQUE_SIZE must be a power of two");
+
+extern "C" char __resident_start__[];
+extern "C" char __resident_end__[];
+
+struct Job {
+    JobFn fn;
+    void* arg;
+    uint32_t begin;
+    uint32_t end;
+    JobCounter* counter;
+};
+
+// Chase-Lev deque with a fixed ring. The owner pushes and pops at bottom;
+// the other core steals at top. Both cores run these on shared SRAM, where
+// the RP2350 supports exclusive (LDREX/STREX) accesses from either core.
+struct JobDeque {
+    volatile int32_t top;
+    volatile int32_t bottom;
+    Job jobs[JOB_DEQUE_SIZE];
+};
+
+static JobDeque g_deques[2];
+
+// Non-resident jobs: a private stack on core 0, and a small ring through
+// which core 1 hands such jobs to core 0
+static Job g_pinned[JOB_PINNED_SIZE];
+static uint32_t g_pinnedCount;
+static Job g_inbox[JOB_INBOX_SIZE];
+static volatile uint32_t g_inboxHead;
+static volatile uint32_t g_inboxTail;
+
+static JobStats g_stats;
+static bool g_started;
+
+// Macros rather than functions so that nothing here lands outside .resident
+#define sev() __asm__ volatile("dsb\n\tsev" ::: "memory")
+#define wfe() __asm__ volatile("wfe" ::: "memory")
+
+static bool APP_RESIDENT isResident(JobFn fn) {
+    const uintptr_t addr = (uintptr_t)fn & ~(uintptr_t)1u;
+    return addr >= (uintptr_t)__resident_start__ && addr < (uintptr_t)__resident_end__;
+}
+
+static bool APP_RESIDENT dequePush(JobDeque& d, const Job& job) {
+    const int32_t b = d.bottom;
+    const int32_t t = __atomic_load_n(&d.top, __ATOMIC_ACQUIRE);
+    if (b - t >= JOB_DEQUE_SIZE) return false;
+    d.jobs[b & (JOB_DEQUE_SIZE - 1)] = job;
+    __atomic_store_n(&d.bottom, b + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static bool APP_RESIDENT dequePop(JobDeque& d, Job* out) {
+    const int32_t b = d.bottom - 1;
+    __atomic_store_n(&d.bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int32_t t = __atomic_load_n(&d.top, __ATOMIC_RELAXED);
+    if (t > b) {
+        __atomic_store_n(&d.bottom, b + 1, __ATOMIC_RELAXED);
+        return false;
+    }
+    *out = d.jobs[b & (JOB_DEQUE_SIZE - 1)];
+    if (t != b) return true;
+    // Last job: the other core may be stealing it right now
+    const bool won = __atomic_compare_exchange_n(&d.top, &t, t + 1, false,
+                                                 __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+    __atomic_store_n(&d.bottom, b + 1, __ATOMIC_RELAXED);
+    return won;
+}
+
+static bool APP_RESIDENT dequeSteal(JobDeque& d, Job* out) {
+    int32_t t = __atomic_load_n(&d.top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    const int32_t b = __atomic_load_n(&d.bottom, __ATOMIC_ACQUIRE);
+    if (t >= b) return false;
+    // Read before claiming: the slot is only reused after top moves on,
+    // in which case the CAS below fails and the copy is discarded
+    const Job job = d.jobs[t & (JOB_DEQUE_SIZE - 1)];
+    if (!__atomic_compare_exchange_n(&d.top, &t, t + 1, false,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        return false;
+    }
+    *out = job;
+    return true;
+}
+
+// Core 1 only. Waits for core 0 to drain the inbox if it is full.
+static void APP_RESIDENT inboxPush(const Job& job) {
+    const uint32_t head = g_inboxHead;
+    while (head - __atomic_load_n(&g_inboxTail, __ATOMIC_ACQUIRE) == JOB_INBOX_SIZE) wfe();
+    g_inbox[head % JOB_INBOX_SIZE] = job;
+    __atomic_store_n(&g_inboxHead, head + 1, __ATOMIC_RELEASE);
+}
+
+// Core 0 only
+static bool APP_RESIDENT inboxPop(Job* out) {
+    const uint32_t tail = g_inboxTail;
+    if (tail == __atomic_load_n(&g_inboxHead, __ATOMIC_ACQUIRE)) return false;
+    *out = g_inbox[tail % JOB_INBOX_SIZE];
+    __atomic_store_n(&g_inboxTail, tail + 1, __ATOMIC_RELEASE);
+    sev();
+    return true;
+}
+
+static void APP_RESIDENT runJob(const Job& job, uint32_t core) {
+    job.fn(job.arg, job.begin, job.end);
+    g_stats.executed[core]++;
+    if (job.counter) {
+        __atomic_sub_fetch(&job.counter->pending, 1, __ATOMIC_RELEASE);
+    }
+    sev();
+}
+
+// Work only core 0 can do comes first, so that core 1 can keep stealing
+// the rest. Then the own deque (newest job, warm data), then the other
+// core's oldest job.
+static bool APP_RESIDENT runOne(uint32_t core) {
+    Job job;
+    if (core == 0 && g_pinnedCount != 0) {
+        runJob(g_pinned[--g_pinnedCount], 0);
+        return true;
+    }
+    if (core == 0 && inboxPop(&job)) {
+        runJob(job, 0);
+        return true;
+    }
+    if (dequePop(g_deques[core], &job)) {
+        runJob(job, core);
+        return true;
+    }
+    if (dequeSteal(g_deques[core ^ 1u], &job)) {
+        g_stats.stolen[core]++;
+        runJob(job, core);
+        return true;
+    }
+    return false;
+}
+
+static void APP_RESIDENT core1Worker(void) {
+    for (;;) {
+        if (!runOne(1)) wfe();
+    }
+}
+
+extern "C" bool job_system_start(void) {
+    if (g_started) return true;
+    if (app_core_num() != 0) return false;
+    g_started = true;
+    multicore_launch_core1((uintptr_t)core1Worker);
+    return true;
+}
+
+extern "C" void APP_RESIDENT job_submit(JobCounter* counter, JobFn fn, void* arg,
+                                        uint32_t begin, uint32_t end) {
+    const Job job = {fn, arg, begin, end, counter};
+    const uint32_t core = app_core_num();
+    if (counter) {
+        __atomic_add_fetch(&counter->pending, 1, __ATOMIC_RELAXED);
+    }
+
+    bool queued = true;
+    if (isResident(fn)) {
+        queued = dequePush(g_deques[core], job);
+    } else if (core == 0) {
+        queued = g_pinnedCount < JOB_PINNED_SIZE;
+        if (queued) g_pinned[g_pinnedCount++] = job;
+    } else {
+        inboxPush(job);
+    }
+
+    if (!queued) {
+        // Core 1 never gets here with a non-resident job
+        __atomic_add_fetch(&g_stats.inlined, 1, __ATOMIC_RELAXED);
+        runJob(job, core);
+        return;
+    }
+    sev();
+}
+
+extern "C" void APP_RESIDENT job_wait(JobCounter* counter) {
+    const uint32_t core = app_core_num();
+    while (__atomic_load_n(&counter->pending, __ATOMIC_ACQUIRE) != 0) {
+        if (!runOne(core)) wfe();
+    }
+}
+
+extern "C" void APP_RESIDENT parallel_for(uint32_t count, uint32_t grain, JobFn fn, void* arg) {
+    if (count == 0) return;
+    if (grain == 0) {
+        // A few chunks per core so that stealing can even out the load
+        grain = (count + 7u) / 8u;
+    }
+    JobCounter done = {0};
+    for (uint32_t begin = 0; begin < count; begin += grain) {
+        const uint32_t end = (count - begin > grain) ? begin + grain : count;
+        job_submit(&done, fn, arg, begin, end);
+    }
+    job_wait(&done);
+}
+
+extern "C" void job_system_stats(JobStats* out) {
+    *out = g_stats;
+}
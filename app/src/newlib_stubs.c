@@ -51,6 +51,12 @@ extern char __heap_end__[];
 // and other global objects need to allocate memory.
 static char* heapPtr = HEAP_START;
 
+// Most recent allocation and the heap top right after it. While nothing else
+// has been allocated since, realloc can resize that block in place instead of
+// copying it (the common case for a String that is being appended to).
+static char* lastAlloc = NULL;
+static char* lastAllocEnd = NULL;
+
 #ifdef __cplusplus
 // Heap initialization constructor with highest priority (runs first)
 // This is a safety net to ensure heap is ready before any other constructors.
@@ -84,6 +90,8 @@ void* malloc(size_t size) {
   }
   
   heapPtr = next;
+  lastAlloc = ptr;
+  lastAllocEnd = next;
   return ptr;
 }
 
@@ -115,8 +123,18 @@ void* realloc(void* ptr, size_t size) {
     free(ptr);
     return NULL;
   }
-  // For bump allocator, just allocate new block
-  // (Can't actually resize in-place)
+  // Resize in place if this is the top block of the heap
+  if ((char*)ptr == lastAlloc && heapPtr == lastAllocEnd) {
+    size_t aligned = (size + 3) & ~3;
+    char* next = lastAlloc + aligned;
+    if (next > HEAP_END) {
+      return NULL;  // Out of memory
+    }
+    heapPtr = next;
+    lastAllocEnd = next;
+    return ptr;
+  }
+  // Otherwise allocate a new block (the old one is not reclaimed)
   void* newPtr = malloc(size);
   if (newPtr && ptr) {
     // Copy old data (but we don't know old size, so this is limited)
@@ -0,0 +1,494 @@
+// Number formatting core - see num_format.h
+//
+// Integers are written front to back into their final position: the digit
+// count is known up front, so there is no reverse pass. Decimal output
+// emits two digits per division from a 200-byte pair table, and the
+// compiler lowers the constant divisions to multiply-high. Power-of-two
+// bases never divide at all.
+//
+// num_fmt_shortest uses Grisu2 (Loitsch, "Printing Floating-Point Numbers
+// Quickly and Accurately with Integers", PLDI 2010): the value and its
+// rounding boundaries are scaled by a cached power of ten into 64-bit
+// fixed point and digits are generated until the result is unambiguous.
+// It always round-trips and is the shortest representation for >99.9% of
+// inputs; it never falls back to big-number arithmetic.
+
+#include "num_format.h"
+
+#include <string.h>
+
+#ifdef __FAST_MATH__
+#error "num_format.cpp must be built without -ffast-math (see build.bat)"
+#endif
+
+static const char kDigits36[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+static const char kDigitPairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const uint32_t kPow10_32[10] = {
+    1u, 10u, 100u, 1000u, 10000u, 100000u,
+    1000000u, 10000000u, 100000000u, 1000000000u
+};
+
+/*********************************************/
+/*  Integers                                 */
+/*********************************************/
+
+static inline unsigned int decimalDigits32(uint32_t v) {
+    unsigned int n = 1;
+    while (n < 10 && v >= kPow10_32[n]) n++;
+    return n;
+}
+
+// Writes the last digits of v backwards so that they end just before `end`
+static inline void writeDecimalBackwards(char* end, uint32_t v) {
+    while (v >= 100) {
+        uint32_t q = v / 100;
+        unsigned int r = (v - q * 100) * 2;
+        v = q;
+        *--end = kDigitPairs[r + 1];
+        *--end = kDigitPairs[r];
+    }
+    if (v >= 10) {
+        *--end = kDigitPairs[v * 2 + 1];
+        *--end = kDigitPairs[v * 2];
+    } else {
+        *--end = (char)('0' + v);
+    }
+}
+
+// Exactly eight digits, zero-padded (v < 1e8)
+static inline void writeDecimal8(char* out, uint32_t v) {
+    for (int i = 6; i >= 0; i -= 2) {
+        uint32_t q = v / 100;
+        unsigned int r = (v - q * 100) * 2;
+        v = q;
+        out[i] = kDigitPairs[r];
+        out[i + 1] = kDigitPairs[r + 1];
+    }
+}
+
+static unsigned int formatDecimal32(char* out, uint32_t v) {
+    unsigned int n = decimalDigits32(v);
+    writeDecimalBackwards(out + n, v);
+    out[n] = 0;
+    return n;
+}
+
+extern "C" unsigned int num_fmt_u32(char* out, uint32_t value, unsigned int base) {
+    if (base == 10) return formatDecimal32(out, value);
+    if (base < 2 || base > 36) {
+        *out = 0;
+        return 0;
+    }
+
+    if ((base & (base - 1)) == 0) {
+        const unsigned int shift = __builtin_ctz(base);
+        const uint32_t mask = base - 1;
+        const unsigned int bits = value ? 32 - __builtin_clz(value) : 1;
+        const unsigned int n = (bits + shift - 1) / shift;
+        for (unsigned int i = n; i > 0; i--) {
+            out[i - 1] = kDigits36[value & mask];
+            value >>= shift;
+        }
+        out[n] = 0;
+        return n;
+    }
+
+    // Remaining bases are rare enough for one division per digit
+    char tmp[NUM_FMT_U32_BUF];
+    char* p = tmp + sizeof(tmp);
+    do {
+        uint32_t q = value / base;
+        *--p = kDigits36[value - q * base];
+        value = q;
+    } while (value != 0);
+    unsigned int n = (unsigned int)(tmp + sizeof(tmp) - p);
+    memcpy(out, p, n);
+    out[n] = 0;
+    return n;
+}
+
+extern "C" unsigned int num_fmt_i32(char* out, int32_t value, unsigned int base) {
+    if (value < 0 && base == 10) {
+        *out = '-';
+        return 1 + formatDecimal32(out + 1, 0u - (uint32_t)value);
+    }
+    return num_fmt_u32(out, (uint32_t)value, base);
+}
+
+extern "C" unsigned int num_fmt_u64(char* out, uint64_t value) {
+    if (value <= 0xFFFFFFFFu) return formatDecimal32(out, (uint32_t)value);
+
+    // 64-bit division is a library call on Cortex-M, so split into 8-digit
+    // chunks with at most two of them and format each chunk in 32 bits.
+    uint64_t high = value / 100000000u;
+    uint32_t low = (uint32_t)(value - high * 100000000u);
+    unsigned int n;
+    if (high <= 0xFFFFFFFFu) {
+        n = formatDecimal32(out, (uint32_t)high);
+    } else {
+        uint32_t top = (uint32_t)(high / 100000000u);
+        uint32_t mid = (uint32_t)(high - (uint64_t)top * 100000000u);
+        n = formatDecimal32(out, top);
+        writeDecimal8(out + n, mid);
+        n += 8;
+    }
+    writeDecimal8(out + n, low);
+    n += 8;
+    out[n] = 0;
+    return n;
+}
+
+/*********************************************/
+/*  Floating point helpers                   */
+/*********************************************/
+
+static unsigned int formatSpecial(char* out, bool negative, bool isNan) {
+    char* p = out;
+    if (negative && !isNan) *p++ = '-';
+    memcpy(p, isNan ? "nan" : "inf", 4);
+    return (unsigned int)(p - out) + 3;
+}
+
+static inline uint64_t doubleBits(double v) {
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+/*********************************************/
+/*  Fixed point                              */
+/*********************************************/
+
+// Powers of ten up to 1e22 are exact in a double
+static const double kPow10Double[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Exact a * b - product for product = a * b rounded (Dekker's two-product).
+// Written out instead of fma() because newlib's generic fma() is not fused.
+static double productError(double a, double b, double product) {
+    const double kSplit = 134217729.0;  // 2^27 + 1
+    double t = a * kSplit;
+    const double aHigh = t - (t - a), aLow = a - aHigh;
+    t = b * kSplit;
+    const double bHigh = t - (t - b), bLow = b - bHigh;
+    return ((aHigh * bHigh - product) + aHigh * bLow + aLow * bHigh) + aLow * bLow;
+}
+
+extern "C" unsigned int num_fmt_fixed(char* out, double value, unsigned int decimals) {
+    const uint64_t bits = doubleBits(value);
+    const bool negative = (bits >> 63) != 0;
+    if (((bits >> 52) & 0x7FF) == 0x7FF) {
+        return formatSpecial(out, negative, (bits & 0xFFFFFFFFFFFFFull) != 0);
+    }
+
+    double magnitude = negative ? -value : value;
+    if (magnitude >= 1e18) return num_fmt_shortest(out, value);
+
+    // Keep the scaled value inside uint64_t; anything dropped here is far
+    // below the 17 significant digits a double can carry and prints as 0.
+    unsigned int exact = decimals > 22 ? 22 : decimals;
+    double scaled = magnitude * kPow10Double[exact];
+    while (scaled >= 1e18) {
+        exact--;
+        scaled = magnitude * kPow10Double[exact];
+    }
+
+    // The product is rounded, but its exact error is recoverable. That only
+    // matters when the rounded product sits on a tie (rest == 0.5) or is an
+    // integer whose true value may lie just below it (rest == 0, which is
+    // always the case above 2^52); everywhere else `rest` alone decides.
+    uint64_t digits = (uint64_t)scaled;
+    double rest = scaled - (double)digits;
+    if (rest == 0.5) {
+        double error = productError(magnitude, kPow10Double[exact], scaled);
+        if (error > 0 || (error == 0 && (digits & 1))) digits++;
+    } else if (rest == 0) {
+        double error = productError(magnitude, kPow10Double[exact], scaled);
+        int64_t whole = (int64_t)error;
+        if ((double)whole > error) whole--;
+        digits += whole;
+        rest = error - (double)whole;
+        if (rest > 0.5 || (rest == 0.5 && (digits & 1))) digits++;
+    } else if (rest > 0.5) {
+        digits++;
+    }
+
+    char* p = out;
+    if (negative) *p++ = '-';
+
+    uint64_t integral = digits;
+    uint64_t fraction = 0;
+    if (exact > 0) {
+        uint64_t divisor = 1;
+        for (unsigned int i = 0; i < exact; i++) divisor *= 10;
+        integral = digits / divisor;
+        fraction = digits - integral * divisor;
+    }
+    p += num_fmt_u64(p, integral);
+
+    if (decimals > 0) {
+        *p++ = '.';
+        // Zero-pad the fraction to `exact` digits, then pad the remainder
+        char frac[NUM_FMT_U64_BUF];
+        unsigned int fracLen = num_fmt_u64(frac, fraction);
+        unsigned int pad = exact > fracLen ? exact - fracLen : 0;
+        memset(p, '0', pad);
+        p += pad;
+        memcpy(p, frac, exact ? fracLen : 0);
+        p += exact ? fracLen : 0;
+        memset(p, '0', decimals - exact);
+        p += decimals - exact;
+    }
+    *p = 0;
+    return (unsigned int)(p - out);
+}
+
+/*********************************************/
+/*  Shortest round-trip (Grisu2)             */
+/*********************************************/
+
+namespace {
+
+// A 64-bit significand with binary exponent: value = f * 2^e
+struct DiyFp {
+    uint64_t f;
+    int e;
+
+    DiyFp() : f(0), e(0) {}
+    DiyFp(uint64_t fp, int exp) : f(fp), e(exp) {}
+
+    DiyFp operator-(const DiyFp& rhs) const { return DiyFp(f - rhs.f, e); }
+
+    // Upper 64 bits of the 128-bit product, rounded
+    DiyFp operator*(const DiyFp& rhs) const {
+        const uint64_t M32 = 0xFFFFFFFFu;
+        const uint64_t a = f >> 32, b = f & M32;
+        const uint64_t c = rhs.f >> 32, d = rhs.f & M32;
+        const uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+        uint64_t tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+        tmp += 1u << 31;
+        return DiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), e + rhs.e + 64);
+    }
+
+    DiyFp normalize() const {
+        int s = __builtin_clzll(f);
+        return DiyFp(f << s, e - s);
+    }
+};
+
+// 10^k as normalized DiyFp for k = -348, -340, ..., 340
+static const DiyFp kCachedPowers[] = {
+  DiyFp(0xfa8fd5a0081c0288ull, -1220), DiyFp(0xbaaee17fa23ebf76ull, -1193), DiyFp(0x8b16fb203055ac76ull, -1166),
+  DiyFp(0xcf42894a5dce35eaull, -1140), DiyFp(0x9a6bb0aa55653b2dull, -1113), DiyFp(0xe61acf033d1a45dfull, -1087),
+  DiyFp(0xab70fe17c79ac6caull, -1060), DiyFp(0xff77b1fcbebcdc4full, -1034), DiyFp(0xbe5691ef416bd60cull, -1007),
+  DiyFp(0x8dd01fad907ffc3cull, -980), DiyFp(0xd3515c2831559a83ull, -954), DiyFp(0x9d71ac8fada6c9b5ull, -927),
+  DiyFp(0xea9c227723ee8bcbull, -901), DiyFp(0xaecc49914078536dull, -874), DiyFp(0x823c12795db6ce57ull, -847),
+  DiyFp(0xc21094364dfb5637ull, -821), DiyFp(0x9096ea6f3848984full, -794), DiyFp(0xd77485cb25823ac7ull, -768),
+  DiyFp(0xa086cfcd97bf97f4ull, -741), DiyFp(0xef340a98172aace5ull, -715), DiyFp(0xb23867fb2a35b28eull, -688),
+  DiyFp(0x84c8d4dfd2c63f3bull, -661), DiyFp(0xc5dd44271ad3cdbaull, -635), DiyFp(0x936b9fcebb25c996ull, -608),
+  DiyFp(0xdbac6c247d62a584ull, -582), DiyFp(0xa3ab66580d5fdaf6ull, -555), DiyFp(0xf3e2f893dec3f126ull, -529),
+  DiyFp(0xb5b5ada8aaff80b8ull, -502), DiyFp(0x87625f056c7c4a8bull, -475), DiyFp(0xc9bcff6034c13053ull, -449),
+  DiyFp(0x964e858c91ba2655ull, -422), DiyFp(0xdff9772470297ebdull, -396), DiyFp(0xa6dfbd9fb8e5b88full, -369),
+  DiyFp(0xf8a95fcf88747d94ull, -343), DiyFp(0xb94470938fa89bcfull, -316), DiyFp(0x8a08f0f8bf0f156bull, -289),
+  DiyFp(0xcdb02555653131b6ull, -263), DiyFp(0x993fe2c6d07b7facull, -236), DiyFp(0xe45c10c42a2b3b06ull, -210),
+  DiyFp(0xaa242499697392d3ull, -183), DiyFp(0xfd87b5f28300ca0eull, -157), DiyFp(0xbce5086492111aebull, -130),
+  DiyFp(0x8cbccc096f5088ccull, -103), DiyFp(0xd1b71758e219652cull, -77), DiyFp(0x9c40000000000000ull, -50),
+  DiyFp(0xe8d4a51000000000ull, -24), DiyFp(0xad78ebc5ac620000ull, 3), DiyFp(0x813f3978f8940984ull, 30),
+  DiyFp(0xc097ce7bc90715b3ull, 56), DiyFp(0x8f7e32ce7bea5c70ull, 83), DiyFp(0xd5d238a4abe98068ull, 109),
+  DiyFp(0x9f4f2726179a2245ull, 136), DiyFp(0xed63a231d4c4fb27ull, 162), DiyFp(0xb0de65388cc8ada8ull, 189),
+  DiyFp(0x83c7088e1aab65dbull, 216), DiyFp(0xc45d1df942711d9aull, 242), DiyFp(0x924d692ca61be758ull, 269),
+  DiyFp(0xda01ee641a708deaull, 295), DiyFp(0xa26da3999aef774aull, 322), DiyFp(0xf209787bb47d6b85ull, 348),
+  DiyFp(0xb454e4a179dd1877ull, 375), DiyFp(0x865b86925b9bc5c2ull, 402), DiyFp(0xc83553c5c8965d3dull, 428),
+  DiyFp(0x952ab45cfa97a0b3ull, 455), DiyFp(0xde469fbd99a05fe3ull, 481), DiyFp(0xa59bc234db398c25ull, 508),
+  DiyFp(0xf6c69a72a3989f5cull, 534), DiyFp(0xb7dcbf5354e9beceull, 561), DiyFp(0x88fcf317f22241e2ull, 588),
+  DiyFp(0xcc20ce9bd35c78a5ull, 614), DiyFp(0x98165af37b2153dfull, 641), DiyFp(0xe2a0b5dc971f303aull, 667),
+  DiyFp(0xa8d9d1535ce3b396ull, 694), DiyFp(0xfb9b7cd9a4a7443cull, 720), DiyFp(0xbb764c4ca7a44410ull, 747),
+  DiyFp(0x8bab8eefb6409c1aull, 774), DiyFp(0xd01fef10a657842cull, 800), DiyFp(0x9b10a4e5e9913129ull, 827),
+  DiyFp(0xe7109bfba19c0c9dull, 853), DiyFp(0xac2820d9623bf429ull, 880), DiyFp(0x80444b5e7aa7cf85ull, 907),
+  DiyFp(0xbf21e44003acdd2dull, 933), DiyFp(0x8e679c2f5e44ff8full, 960), DiyFp(0xd433179d9c8cb841ull, 986),
+  DiyFp(0x9e19db92b4e31ba9ull, 1013), DiyFp(0xeb96bf6ebadf77d9ull, 1039), DiyFp(0xaf87023b9bf0ee6bull, 1066)
+};
+
+// Picks a cached power c = 10^-k so that w * c has a binary exponent in
+// [-60, -32], i.e. the integral part of the scaled value fits 32 bits.
+static DiyFp cachedPower(int e, int* k) {
+    // ceil((-61 - e) * log10(2)) shifted into table range
+    double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int ik = (int)dk;
+    if (dk - ik > 0.0) ik++;
+    unsigned int index = (unsigned int)((ik >> 3) + 1);
+    *k = -(-348 + (int)(index * 8));
+    return kCachedPowers[index];
+}
+
+static void grisuRound(char* buffer, unsigned int len, uint64_t delta, uint64_t rest,
+                       uint64_t tenKappa, uint64_t distance) {
+    while (rest < distance && delta - rest >= tenKappa &&
+           (rest + tenKappa < distance || distance - rest > rest + tenKappa - distance)) {
+        buffer[len - 1]--;
+        rest += tenKappa;
+    }
+}
+
+static unsigned int digitGen(const DiyFp& w, const DiyFp& mp, uint64_t delta,
+                             char* buffer, int* k) {
+    const DiyFp one(1ull << -mp.e, mp.e);
+    const uint64_t distance = (mp - w).f;
+    uint32_t p1 = (uint32_t)(mp.f >> -one.e);
+    uint64_t p2 = mp.f & (one.f - 1);
+    int kappa = (int)decimalDigits32(p1);
+    unsigned int len = 0;
+
+    while (kappa > 0) {
+        uint32_t d = p1 / kPow10_32[kappa - 1];
+        p1 -= d * kPow10_32[kappa - 1];
+        if (d || len) buffer[len++] = (char)('0' + d);
+        kappa--;
+        uint64_t rest = ((uint64_t)p1 << -one.e) + p2;
+        if (rest <= delta) {
+            *k += kappa;
+            grisuRound(buffer, len, delta, rest, (uint64_t)kPow10_32[kappa] << -one.e, distance);
+            return len;
+        }
+    }
+
+    for (;;) {
+        p2 *= 10;
+        delta *= 10;
+        char d = (char)(p2 >> -one.e);
+        if (d || len) buffer[len++] = (char)('0' + d);
+        p2 &= one.f - 1;
+        kappa--;
+        if (p2 < delta) {
+            *k += kappa;
+            int index = -kappa;
+            grisuRound(buffer, len, delta, p2, one.f, distance * (index < 10 ? kPow10_32[index] : 0));
+            return len;
+        }
+    }
+}
+
+// v = f * 2^e with boundaries m- and m+ halfway to the neighbouring values.
+// `lowerCloser` is set when f is the smallest significand of its binade, in
+// which case the gap below is half the gap above.
+static unsigned int grisu2(uint64_t f, int e, bool lowerCloser, char* buffer, int* k) {
+    DiyFp plus = DiyFp((f << 1) + 1, e - 1).normalize();
+    DiyFp minus = lowerCloser ? DiyFp((f << 2) - 1, e - 2) : DiyFp((f << 1) - 1, e - 1);
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+
+    const DiyFp c = cachedPower(plus.e, k);
+    const DiyFp w = DiyFp(f, e).normalize() * c;
+    DiyFp wPlus = plus * c;
+    DiyFp wMinus = minus * c;
+    wMinus.f++;
+    wPlus.f--;
+    return digitGen(w, wPlus, wPlus.f - wMinus.f, buffer, k);
+}
+
+static unsigned int writeExponent(char* out, int exp) {
+    char* p = out;
+    if (exp < 0) {
+        *p++ = '-';
+        exp = -exp;
+    }
+    return (unsigned int)(p - out) + formatDecimal32(p, (uint32_t)exp);
+}
+
+// Lays out `len` significant digits with decimal exponent k (value is
+// digits * 10^k). The buffer must have room for NUM_FMT_FLOAT_BUF bytes.
+static unsigned int prettify(char* buffer, unsigned int len, int k) {
+    const int length = (int)len;
+    const int kk = length + k;  // position of the decimal point
+
+    if (k >= 0 && kk <= 21) {
+        // 1234e7 -> 12340000000.0
+        for (int i = length; i < kk; i++) buffer[i] = '0';
+        buffer[kk] = '.';
+        buffer[kk + 1] = '0';
+        buffer[kk + 2] = 0;
+        return (unsigned int)kk + 2;
+    }
+    if (kk > 0 && kk <= 21) {
+        // 1234e-2 -> 12.34
+        memmove(&buffer[kk + 1], &buffer[kk], (size_t)(length - kk));
+        buffer[kk] = '.';
+        buffer[length + 1] = 0;
+        return len + 1;
+    }
+    if (kk > -6 && kk <= 0) {
+        // 1234e-6 -> 0.001234
+        const int offset = 2 - kk;
+        memmove(&buffer[offset], &buffer[0], (size_t)length);
+        buffer[0] = '0';
+        buffer[1] = '.';
+        for (int i = 2; i < offset; i++) buffer[i] = '0';
+        buffer[length + offset] = 0;
+        return len + (unsigned int)offset;
+    }
+    if (length == 1) {
+        // 1e30
+        buffer[1] = 'e';
+        return 2 + writeExponent(&buffer[2], kk - 1);
+    }
+    // 1234e30 -> 1.234e33
+    memmove(&buffer[2], &buffer[1], (size_t)(length - 1));
+    buffer[1] = '.';
+    buffer[length + 1] = 'e';
+    return len + 2 + writeExponent(&buffer[length + 2], kk - 1);
+}
+
+static unsigned int formatShortest(char* out, bool negative, uint64_t f, int e, bool lowerCloser) {
+    char* p = out;
+    if (negative) *p++ = '-';
+    if (f == 0) {
+        memcpy(p, "0.0", 4);
+        return (unsigned int)(p - out) + 3;
+    }
+    int k = 0;
+    unsigned int len = grisu2(f, e, lowerCloser, p, &k);
+    return (unsigned int)(p - out) + prettify(p, len, k);
+}
+
+}  // namespace
+
+extern "C" unsigned int num_fmt_shortest(char* out, double value) {
+    const uint64_t bits = doubleBits(value);
+    const bool negative = (bits >> 63) != 0;
+    const unsigned int biased = (unsigned int)((bits >> 52) & 0x7FF);
+    const uint64_t mantissa = bits & 0xFFFFFFFFFFFFFull;
+    if (biased == 0x7FF) return formatSpecial(out, negative, mantissa != 0);
+
+    if (biased == 0) return formatShortest(out, negative, mantissa, 1 - 1075, false);
+    return formatShortest(out, negative, mantissa | (1ull << 52), (int)biased - 1075,
+                          mantissa == 0 && biased > 1);
+}
+
+extern "C" unsigned int num_fmt_shortest_f(char* out, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    const bool negative = (bits >> 31) != 0;
+    const unsigned int biased = (bits >> 23) & 0xFF;
+    const uint32_t mantissa = bits & 0x7FFFFFu;
+    if (biased == 0xFF) return formatSpecial(out, negative, mantissa != 0);
+
+    // Same algorithm with single-precision boundaries, so the digits are
+    // the shortest that round-trip through a float, not through a double
+    if (biased == 0) return formatShortest(out, negative, mantissa, 1 - 150, false);
+    return formatShortest(out, negative, mantissa | (1u << 23), (int)biased - 150,
+                          mantissa == 0 && biased > 1);
+}
@@ -0,0 +1,363 @@
+// Number parsing core - see num_parse.h
+//
+// Digits are validated and converted four at a time (SWAR): one word load,
+// one mask test that rejects any non-digit byte, and two multiplies that
+// fold the four bytes into a value 0..9999. Floating point uses Clinger's
+// fast path: when the decimal significand and the power of ten are both
+// exact in binary, a single IEEE multiply or divide is correctly rounded.
+// Everything else hands a NUL-terminated copy of the original text to
+// strtod(), so rare inputs stay exact without a big-number implementation
+// of our own.
+
+#include "num_parse.h"
+#include "num_format.h"
+
+#ifdef __FAST_MATH__
+#error "num_parse.cpp must be built without -ffast-math (see build.bat)"
+#endif
+
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static inline bool isSpace(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+static inline bool isDigit(char c) {
+    return (unsigned char)(c - '0') < 10;
+}
+
+static inline char lowerAscii(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c;
+}
+
+static unsigned int skipSpace(const char* s, unsigned int i, unsigned int len) {
+    while (i < len && isSpace(s[i])) i++;
+    return i;
+}
+
+static NumParseStatus finish(const char* s, unsigned int end, unsigned int len) {
+    return skipSpace(s, end, len) == len ? NUM_PARSE_OK : NUM_PARSE_TRAILING;
+}
+
+/*********************************************/
+/*  SWAR digit runs                          */
+/*********************************************/
+
+// Four characters as one word, first character in the low byte (both
+// Cortex-M33 and the host are little-endian; unaligned loads are allowed).
+static inline uint32_t load4(const char* p) {
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+// True when all four bytes are '0'..'9': the high nibble must be 3 both
+// before and after adding 6 to each byte (which carries '9'+1 into 0x40).
+static inline bool allDigits4(uint32_t w) {
+    return ((w & 0xF0F0F0F0u) | (((w + 0x06060606u) & 0xF0F0F0F0u) >> 4)) == 0x33333333u;
+}
+
+// "1234" -> 1234: combine neighbouring bytes into 2-digit lanes, then lanes
+static inline uint32_t convert4(uint32_t w) {
+    w = ((w & 0x0F0F0F0Fu) * (10u * 256u + 1u)) >> 8;
+    return ((w & 0x00FF00FFu) * (100u * 65536u + 1u)) >> 16;
+}
+
+// Up to 19 decimal digits accumulate exactly in `mantissa`; later digits
+// only count as `dropped` and set `sticky` when any of them is non-zero.
+struct DigitRun {
+    uint64_t mantissa;
+    unsigned int kept;
+    unsigned int dropped;
+    bool sticky;
+};
+
+static const uint64_t kMantissaLimit = 1000000000000000000ull;  // 1e18
+
+static unsigned int scanDigits(const char* s, unsigned int i, unsigned int len, DigitRun* run) {
+    while (i + 4 <= len && run->mantissa < kMantissaLimit / 10000) {
+        uint32_t w = load4(s + i);
+        if (!allDigits4(w)) break;
+        run->mantissa = run->mantissa * 10000 + convert4(w);
+        run->kept += 4;
+        i += 4;
+    }
+    while (i < len && isDigit(s[i])) {
+        if (run->mantissa < kMantissaLimit) {
+            run->mantissa = run->mantissa * 10 + (uint32_t)(s[i] - '0');
+            run->kept++;
+        } else {
+            run->dropped++;
+            if (s[i] != '0') run->sticky = true;
+        }
+        i++;
+    }
+    return i;
+}
+
+/*********************************************/
+/*  Integers                                 */
+/*********************************************/
+
+// Sign and digits shared by both integer parsers. Returns false when there
+// are no digits; `overflow` is set when the magnitude exceeds `limit`.
+static bool scanInteger(const char* s, unsigned int len, bool* negative, uint64_t* magnitude,
+                        bool* overflow, unsigned int* end, uint64_t positiveLimit,
+                        uint64_t negativeLimit) {
+    unsigned int i = skipSpace(s, 0, len);
+    *negative = false;
+    if (i < len && (s[i] == '-' || s[i] == '+')) *negative = (s[i++] == '-');
+
+    DigitRun run = {0, 0, 0, false};
+    unsigned int stop = scanDigits(s, i, len, &run);
+    if (stop == i) return false;
+
+    *end = stop;
+    *magnitude = run.mantissa;
+    *overflow = run.dropped != 0 || run.mantissa > (*negative ? negativeLimit : positiveLimit);
+    return true;
+}
+
+extern "C" NumParseStatus num_parse_long(const char* s, unsigned int len, long* out, unsigned int* consumed) {
+    bool negative, overflow;
+    uint64_t magnitude;
+    unsigned int end = 0;
+    if (!s || !scanInteger(s, len, &negative, &magnitude, &overflow, &end,
+                           (uint64_t)LONG_MAX, (uint64_t)LONG_MAX + 1)) {
+        *out = 0;
+        if (consumed) *consumed = 0;
+        return NUM_PARSE_EMPTY;
+    }
+    if (consumed) *consumed = end;
+    if (overflow) {
+        *out = negative ? LONG_MIN : LONG_MAX;
+        return NUM_PARSE_OVERFLOW;
+    }
+    *out = negative ? (long)(0ul - (unsigned long)magnitude) : (long)magnitude;
+    return finish(s, end, len);
+}
+
+// Like strtoul(), a leading '-' negates the result modulo ULONG_MAX + 1
+extern "C" NumParseStatus num_parse_ulong(const char* s, unsigned int len, unsigned long* out, unsigned int* consumed) {
+    bool negative, overflow;
+    uint64_t magnitude;
+    unsigned int end = 0;
+    if (!s || !scanInteger(s, len, &negative, &magnitude, &overflow, &end,
+                           (uint64_t)ULONG_MAX, (uint64_t)ULONG_MAX)) {
+        *out = 0;
+        if (consumed) *consumed = 0;
+        return NUM_PARSE_EMPTY;
+    }
+    if (consumed) *consumed = end;
+    if (overflow) {
+        *out = ULONG_MAX;
+        return NUM_PARSE_OVERFLOW;
+    }
+    *out = negative ? 0ul - (unsigned long)magnitude : (unsigned long)magnitude;
+    return finish(s, end, len);
+}
+
+/*********************************************/
+/*  Floating point                           */
+/*********************************************/
+
+namespace {
+
+enum DecimalKind { kDecimalNone, kDecimalFinite, kDecimalInf, kDecimalNan };
+
+// value = (-1)^negative * (mantissa [+ sticky]) * 10^exponent
+struct Decimal {
+    unsigned int begin;  // offset of the sign or first digit
+    bool negative;
+    uint64_t mantissa;
+    int exponent;
+    bool sticky;
+};
+
+static bool matchWord(const char* s, unsigned int i, unsigned int len, const char* word) {
+    for (; *word; word++, i++) {
+        if (i >= len || lowerAscii(s[i]) != *word) return false;
+    }
+    return true;
+}
+
+static DecimalKind scanDecimal(const char* s, unsigned int len, Decimal* dec, unsigned int* end) {
+    unsigned int i = skipSpace(s, 0, len);
+    dec->begin = i;
+    dec->negative = false;
+    if (i < len && (s[i] == '-' || s[i] == '+')) dec->negative = (s[i++] == '-');
+
+    if (matchWord(s, i, len, "inf")) {
+        *end = matchWord(s, i, len, "infinity") ? i + 8 : i + 3;
+        return kDecimalInf;
+    }
+    if (matchWord(s, i, len, "nan")) {
+        *end = i + 3;
+        return kDecimalNan;
+    }
+
+    DigitRun run = {0, 0, 0, false};
+    const unsigned int intStart = i;
+    i = scanDigits(s, i, len, &run);
+    bool anyDigits = i != intStart;
+    int exponent = (int)run.dropped;
+
+    if (i < len && s[i] == '.') {
+        const unsigned int fracStart = ++i;
+        const unsigned int keptBefore = run.kept;
+        i = scanDigits(s, i, len, &run);
+        anyDigits = anyDigits || i != fracStart;
+        exponent -= (int)(run.kept - keptBefore);
+    }
+    if (!anyDigits) return kDecimalNone;
+
+    // The exponent only counts when at least one digit follows the 'e'
+    if (i < len && (s[i] == 'e' || s[i] == 'E')) {
+        unsigned int j = i + 1;
+        bool expNegative = false;
+        if (j < len && (s[j] == '-' || s[j] == '+')) expNegative = (s[j++] == '-');
+        if (j < len && isDigit(s[j])) {
+            int e = 0;
+            for (; j < len && isDigit(s[j]); j++) {
+                if (e < 100000) e = e * 10 + (s[j] - '0');
+            }
+            exponent += expNegative ? -e : e;
+            i = j;
+        }
+    }
+
+    dec->mantissa = run.mantissa;
+    dec->exponent = exponent;
+    dec->sticky = run.sticky;
+    *end = i;
+    return kDecimalFinite;
+}
+
+static const double kPow10Double[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const float kPow10Float[11] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+// Text handed to strtod()/strtof() on the slow path
+static const unsigned int kSlowTextSize = 128;
+
+// Copies s[dec.begin, end) - sign, digits, point and exponent exactly as
+// scanned - so the C library rounds from every digit. Returns false if the
+// text does not fit.
+static bool copyDecimalText(const char* s, const Decimal& dec, unsigned int end, char* buf) {
+    const unsigned int n = end - dec.begin;
+    if (n >= kSlowTextSize) return false;
+    memcpy(buf, s + dec.begin, n);
+    buf[n] = '\0';
+    return true;
+}
+
+// Last resort for longer text: "[-]digits[1]e<exp>" from the first 19
+// significant digits, with a trailing '1' standing in for dropped non-zero
+// digits. This can be one ulp off when the value lies very close to a
+// rounding boundary.
+static void canonicalDecimal(const Decimal& dec, char* buf) {
+    char* p = buf;
+    if (dec.negative) *p++ = '-';
+    p += num_fmt_u64(p, dec.mantissa);
+    int exponent = dec.exponent;
+    if (dec.sticky) {
+        *p++ = '1';
+        exponent--;
+    }
+    *p++ = 'e';
+    num_fmt_i32(p, exponent, 10);
+}
+
+}  // namespace
+
+extern "C" NumParseStatus num_parse_double(const char* s, unsigned int len, double* out, unsigned int* consumed) {
+    Decimal dec;
+    unsigned int end = 0;
+    const DecimalKind kind = s ? scanDecimal(s, len, &dec, &end) : kDecimalNone;
+    if (consumed) *consumed = end;
+
+    switch (kind) {
+    case kDecimalNone:
+        *out = 0;
+        return NUM_PARSE_EMPTY;
+    case kDecimalInf:
+        *out = dec.negative ? -HUGE_VAL : HUGE_VAL;
+        return finish(s, end, len);
+    case kDecimalNan:
+        *out = dec.negative ? -NAN : NAN;
+        return finish(s, end, len);
+    case kDecimalFinite:
+        break;
+    }
+
+    double value;
+    if (!dec.sticky && dec.mantissa <= (1ull << 53) &&
+        dec.exponent >= -22 && dec.exponent <= 22) {
+        value = (double)dec.mantissa;
+        value = dec.exponent < 0 ? value / kPow10Double[-dec.exponent]
+                                 : value * kPow10Double[dec.exponent];
+        if (dec.negative) value = -value;
+    } else {
+        char buf[kSlowTextSize];
+        if (!copyDecimalText(s, dec, end, buf)) canonicalDecimal(dec, buf);
+        value = strtod(buf, NULL);
+        if (value > DBL_MAX || value < -DBL_MAX) {
+            *out = value;
+            return NUM_PARSE_OVERFLOW;
+        }
+    }
+    *out = value;
+    return finish(s, end, len);
+}
+
+extern "C" NumParseStatus num_parse_float(const char* s, unsigned int len, float* out, unsigned int* consumed) {
+    Decimal dec;
+    unsigned int end = 0;
+    const DecimalKind kind = s ? scanDecimal(s, len, &dec, &end) : kDecimalNone;
+    if (consumed) *consumed = end;
+
+    switch (kind) {
+    case kDecimalNone:
+        *out = 0;
+        return NUM_PARSE_EMPTY;
+    case kDecimalInf:
+        *out = dec.negative ? -HUGE_VALF : HUGE_VALF;
+        return finish(s, end, len);
+    case kDecimalNan:
+        *out = dec.negative ? -NAN : NAN;
+        return finish(s, end, len);
+    case kDecimalFinite:
+        break;
+    }
+
+    // Single precision has its own fast path so typical sensor values
+    // ("23.75", "-0.004") never touch double arithmetic, which the M33
+    // FPU does not implement in hardware.
+    float value;
+    if (!dec.sticky && dec.mantissa <= (1ull << 24) &&
+        dec.exponent >= -10 && dec.exponent <= 10) {
+        value = (float)(uint32_t)dec.mantissa;
+        value = dec.exponent < 0 ? value / kPow10Float[-dec.exponent]
+                                 : value * kPow10Float[dec.exponent];
+        if (dec.negative) value = -value;
+    } else {
+        char buf[kSlowTextSize];
+        if (!copyDecimalText(s, dec, end, buf)) canonicalDecimal(dec, buf);
+        value = strtof(buf, NULL);
+        if (value > FLT_MAX || value < -FLT_MAX) {
+            *out = value;
+            return NUM_PARSE_OVERFLOW;
+        }
+    }
+    *out = value;
+    return finish(s, end, len);
+}
@@ -0,0 +1,73 @@
+// Buffered Serial output - see serial_tx.h
+
+#include "serial_tx.h"
+
+#include <string.h>
+
+#include "app_syscalls.h"
+#include "app_critical.h"
+#include "gpio_fast.h"
+
+struct SerialTxBuffer {
+    size_t len;
+    char data[SERIAL_TX_BUF_SIZE];
+};
+
+static SerialTxBuffer g_tx[2];
+
+// The buffer is changed only with interrupts masked, and sent from a copy
+// afterwards, so a task switch mid-update cannot lose or mix bytes
+
+// Append `len` (< SERIAL_TX_BUF_SIZE) bytes. If they do not fit, what was
+// queued is first moved to `out`; returns the number of bytes moved.
+static size_t APP_RESIDENT appendLocked(const char* data, size_t len, char* out) {
+    const uint32_t saved = app_critical_enter();
+    SerialTxBuffer& tx = g_tx[app_core_num()];
+    size_t out_len = 0;
+    if (len > SERIAL_TX_BUF_SIZE - tx.len) {
+        out_len = tx.len;
+        app_critical_copy(out, tx.data, out_len);
+        tx.len = 0;
+    }
+    app_critical_copy(tx.data + tx.len, data, len);
+    tx.len += len;
+    app_critical_exit(saved);
+    return out_len;
+}
+
+// Move everything queued to `out`; returns the number of bytes
+static size_t APP_RESIDENT takeLocked(char* out) {
+    const uint32_t saved = app_critical_enter();
+    SerialTxBuffer& tx = g_tx[app_core_num()];
+    const size_t out_len = tx.len;
+    app_critical_copy(out, tx.data, out_len);
+    tx.len = 0;
+    app_critical_exit(saved);
+    return out_len;
+}
+
+extern "C" size_t serial_tx_write(const char* data, size_t len) {
+    if (len >= SERIAL_TX_BUF_SIZE) {
+        // Copying would only split it into more syscalls
+        serial_tx_flush();
+        Serial_writeBuf((const uint8_t*)data, len);
+        return len;
+    }
+    char out[SERIAL_TX_BUF_SIZE];
+    const size_t out_len = appendLocked(data, len, out);
+    if (out_len != 0) {
+        Serial_writeBuf((const uint8_t*)out, out_len);
+    }
+    if (memchr(data, '\n', len) != NULL) {
+        serial_tx_flush();
+    }
+    return len;
+}
+
+extern "C" void serial_tx_flush(void) {
+    char out[SERIAL_TX_BUF_SIZE];
+    const size_t out_len = takeLocked(out);
+    if (out_len != 0) {
+        Serial_writeBuf((const uint8_t*)out, out_len);
+    }
+}
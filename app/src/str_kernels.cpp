@@ -0,0 +1,238 @@
+// SWAR string kernels - see str_kernels.h
+//
+// Every kernel is built from two lane tests on a 32-bit word: which bytes
+// are zero (after XOR with a broadcast character, "which bytes equal c")
+// and which bytes fall in a range (for case mapping). Both return a mask
+// with 0xFF in matching byte lanes, so results can be applied with plain
+// AND/OR and the first/last hit found with a single CTZ/CLZ.
+
+#include "str_kernels.h"
+
+#include <string.h>
+
+static inline uint32_t load4(const char* p) {
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+static inline void store4(char* p, uint32_t w) {
+    memcpy(p, &w, sizeof(w));
+}
+
+static inline uint32_t broadcast(char c) {
+    return 0x01010101u * (uint8_t)c;
+}
+
+#if defined(__ARM_FEATURE_SIMD32)
+
+// UADD8 sets each lane's GE flag when v + 0xFF carries, i.e. v != 0, and SEL
+// then picks 0x00 for those lanes and 0xFF for the rest.
+static inline uint32_t zeroLanes(uint32_t v) {
+    uint32_t mask;
+    __asm__("uadd8 %0, %1, %2\n\t"
+            "sel %0, %3, %2"
+            : "=&r"(mask)
+            : "r"(v), "r"(0xFFFFFFFFu), "r"(0u)
+            : "cc");
+    return mask;
+}
+
+// Lanes with lo <= byte <= hi (lo/hi broadcast): USUB8 sets GE where the
+// subtraction does not borrow, SEL accumulates the two comparisons.
+static inline uint32_t rangeLanes(uint32_t v, uint32_t lo, uint32_t hi) {
+    uint32_t scratch, mask;
+    __asm__("usub8 %0, %2, %3\n\t"
+            "sel %1, %5, %6\n\t"
+            "usub8 %0, %4, %2\n\t"
+            "sel %1, %1, %6"
+            : "=&r"(scratch), "=&r"(mask)
+            : "r"(v), "r"(lo), "r"(hi), "r"(0xFFFFFFFFu), "r"(0u)
+            : "cc");
+    return mask;
+}
+
+#else
+
+// Exact (no false positives from borrows): a lane's high bit survives only
+// when its low seven bits are zero and its own high bit was clear.
+static inline uint32_t zeroLanes(uint32_t v) {
+    uint32_t t = ((v & 0x7F7F7F7Fu) + 0x7F7F7F7Fu) | v | 0x7F7F7F7Fu;
+    return ((~t) >> 7) * 0xFFu;
+}
+
+// Only valid for ASCII bounds (hi < 0x80): compare the low seven bits with
+// carry-free additions, then drop lanes that had the high bit set.
+static inline uint32_t rangeLanes(uint32_t v, uint32_t lo, uint32_t hi) {
+    const uint32_t low7 = v & 0x7F7F7F7Fu;
+    const uint32_t atLeastLo = low7 + (0x80808080u - lo);
+    const uint32_t aboveHi = low7 + (0x7F7F7F7Fu - hi);
+    return (((atLeastLo ^ aboveHi) & ~v & 0x80808080u) >> 7) * 0xFFu;
+}
+
+#endif
+
+static inline unsigned int firstLane(uint32_t mask) {
+    return (unsigned int)__builtin_ctz(mask) >> 3;
+}
+
+static inline unsigned int lastLane(uint32_t mask) {
+    return (31u - (unsigned int)__builtin_clz(mask)) >> 3;
+}
+
+static const uint32_t kUpperA = 0x41414141u;  // 'A'
+static const uint32_t kUpperZ = 0x5A5A5A5Au;  // 'Z'
+static const uint32_t kLowerA = 0x61616161u;  // 'a'
+static const uint32_t kLowerZ = 0x7A7A7A7Au;  // 'z'
+static const uint32_t kCaseBit = 0x20202020u;
+
+static inline uint32_t lowerWord(uint32_t w) {
+    return w | (rangeLanes(w, kUpperA, kUpperZ) & kCaseBit);
+}
+
+static inline char lowerChar(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c | 0x20) : c;
+}
+
+/*********************************************/
+/*  Search                                   */
+/*********************************************/
+
+extern "C" const char* str_find_char(const char* s, unsigned int len, char c) {
+    const uint32_t pattern = broadcast(c);
+    unsigned int i = 0;
+    for (; i + 4 <= len; i += 4) {
+        uint32_t hits = zeroLanes(load4(s + i) ^ pattern);
+        if (hits) return s + i + firstLane(hits);
+    }
+    for (; i < len; i++) {
+        if (s[i] == c) return s + i;
+    }
+    return NULL;
+}
+
+extern "C" const char* str_rfind_char(const char* s, unsigned int len, char c) {
+    const uint32_t pattern = broadcast(c);
+    unsigned int end = len;
+    for (; end >= 4; end -= 4) {
+        uint32_t hits = zeroLanes(load4(s + end - 4) ^ pattern);
+        if (hits) return s + end - 4 + lastLane(hits);
+    }
+    for (; end > 0; end--) {
+        if (s[end - 1] == c) return s + end - 1;
+    }
+    return NULL;
+}
+
+// Substring search tests four candidate positions per step: a candidate
+// survives only if both its first and its last character match, which
+// rejects nearly all positions before memcmp() looks at the middle.
+static inline bool middleMatches(const char* at, const char* needle, unsigned int needleLen) {
+    return needleLen <= 2 || memcmp(at + 1, needle + 1, needleLen - 2) == 0;
+}
+
+extern "C" const char* str_find(const char* s, unsigned int len, const char* needle, unsigned int needleLen) {
+    if (needleLen == 0) return s;
+    if (needleLen > len) return NULL;
+    if (needleLen == 1) return str_find_char(s, len, needle[0]);
+
+    const uint32_t first = broadcast(needle[0]);
+    const uint32_t last = broadcast(needle[needleLen - 1]);
+    const unsigned int starts = len - needleLen + 1;  // candidate positions
+    unsigned int i = 0;
+    for (; i + 4 <= starts; i += 4) {
+        uint32_t hits = zeroLanes((load4(s + i) ^ first) | (load4(s + i + needleLen - 1) ^ last));
+        while (hits) {
+            unsigned int lane = firstLane(hits);
+            if (middleMatches(s + i + lane, needle, needleLen)) return s + i + lane;
+            hits &= ~(0xFFu << (lane * 8));
+        }
+    }
+    for (; i < starts; i++) {
+        if (s[i] == needle[0] && s[i + needleLen - 1] == needle[needleLen - 1] &&
+            middleMatches(s + i, needle, needleLen)) {
+            return s + i;
+        }
+    }
+    return NULL;
+}
+
+extern "C" const char* str_rfind(const char* s, unsigned int len, const char* needle, unsigned int needleLen) {
+    if (needleLen == 0) return s + len;
+    if (needleLen > len) return NULL;
+    if (needleLen == 1) return str_rfind_char(s, len, needle[0]);
+
+    const uint32_t first = broadcast(needle[0]);
+    const uint32_t last = broadcast(needle[needleLen - 1]);
+    unsigned int end = len - needleLen + 1;  // candidates are [0, end)
+    for (; end >= 4; end -= 4) {
+        const unsigned int i = end - 4;
+        uint32_t hits = zeroLanes((load4(s + i) ^ first) | (load4(s + i + needleLen - 1) ^ last));
+        while (hits) {
+            unsigned int lane = lastLane(hits);
+            if (middleMatches(s + i + lane, needle, needleLen)) return s + i + lane;
+            hits &= ~(0xFFu << (lane * 8));
+        }
+    }
+    for (; end > 0; end--) {
+        const char* at = s + end - 1;
+        if (at[0] == needle[0] && at[needleLen - 1] == needle[needleLen - 1] &&
+            middleMatches(at, needle, needleLen)) {
+            return at;
+        }
+    }
+    return NULL;
+}
+
+/*********************************************/
+/*  Case mapping and comparison              */
+/*********************************************/
+
+extern "C" void str_to_lower(char* s, unsigned int len) {
+    unsigned int i = 0;
+    for (; i + 4 <= len; i += 4) {
+        uint32_t w = load4(s + i);
+        uint32_t upper = rangeLanes(w, kUpperA, kUpperZ);
+        if (upper) store4(s + i, w | (upper & kCaseBit));
+    }
+    for (; i < len; i++) s[i] = lowerChar(s[i]);
+}
+
+extern "C" void str_to_upper(char* s, unsigned int len) {
+    unsigned int i = 0;
+    for (; i + 4 <= len; i += 4) {
+        uint32_t w = load4(s + i);
+        uint32_t lower = rangeLanes(w, kLowerA, kLowerZ);
+        if (lower) store4(s + i, w & ~(lower & kCaseBit));
+    }
+    for (; i < len; i++) {
+        if (s[i] >= 'a' && s[i] <= 'z') s[i] = (char)(s[i] & ~0x20);
+    }
+}
+
+extern "C" void str_replace_char(char* s, unsigned int len, char find, char replace) {
+    const uint32_t pattern = broadcast(find);
+    const uint32_t with = broadcast(replace);
+    unsigned int i = 0;
+    for (; i + 4 <= len; i += 4) {
+        uint32_t w = load4(s + i);
+        uint32_t hits = zeroLanes(w ^ pattern);
+        if (hits) store4(s + i, (w & ~hits) | (with & hits));
+    }
+    for (; i < len; i++) {
+        if (s[i] == find) s[i] = replace;
+    }
+}
+
+extern "C" int str_equals_ignore_case(const char* a, const char* b, unsigned int len) {
+    unsigned int i = 0;
+    for (; i + 4 <= len; i += 4) {
+        uint32_t wa = load4(a + i);
+        uint32_t wb = load4(b + i);
+        if (wa != wb && lowerWord(wa) != lowerWord(wb)) return 0;
+    }
+    for (; i < len; i++) {
+        if (lowerChar(a[i]) != lowerChar(b[i])) return 0;
+    }
+    return 1;
+}
@@ -59,9 +59,9 @@ if not exist "%TEMP%" mkdir "%TEMP%"
 if not exist "%BUILD%" mkdir "%BUILD%"
 
 :: ===========================================================================
-::  STEP 1: GENERATE SYSCALL WRAPPERS
+::  STEP 1: GENERATE SYSCALL WRAPPERS AND PIO PROGRAMS
 :: ===========================================================================
-echo [STEP 1/4] Generating syscall wrappers...
+echo [STEP 1/4] Generating syscall wrappers and PIO programs...
 python "%TOOLS%\syscall_gen.py"
 if errorlevel 1 (
   echo.
@@ -69,6 +69,13 @@ if errorlevel 1 (
   goto FAIL
 )
 echo   [OK] Syscall wrappers generated
+python "%TOOLS%\pio_asm.py" "%APP%\pio" "%APP%\src\generated\pio_programs.h"
+if errorlevel 1 (
+  echo.
+  echo [ERROR] pio_asm.py failed!
+  goto FAIL
+)
+echo   [OK] PIO programs assembled
 echo.
 
 :: ===========================================================================
@@ -156,8 +163,17 @@ if /I "%VERBOSE%"=="ON" (
 "%BIN%\arm-none-eabi-gcc.exe" -c "%APP%\src\generated\app_sys_raw.c" -o "%TEMP%\app_sys_raw.o" %CFLAGS% || goto FAIL
 "%BIN%\arm-none-eabi-g++.exe" -c "%APP%\src\app_export.c" -o "%TEMP%\app_export.o" %CFLAGS% || goto FAIL
 "%BIN%\arm-none-eabi-g++.exe" -c "%APP%\src\WString.cpp" -o "%TEMP%\WString.o" %CFLAGS% || goto FAIL
+"%BIN%\arm-none-eabi-g++.exe" -c "%APP%\src\WStringView.cpp" -o "%TEMP%\WStringView.o" %CFLAGS% || goto FAIL
 "%BIN%\arm-none-eabi-g++.exe" -c "%APP%\src\WMath.cpp" -o "%TEMP%\WMath.o" %CFLAGS% || goto FAIL
 "%BIN%\arm-none-eabi-g++.exe" -c "%APP%\src\arduino_utils.cpp" -o "%TEMP%\arduino_utils.o" %CFLAGS% || goto FAIL
+:: Exact float formatting/parsing: -ffast-math would reassociate the error-free
+:: arithmetic these rely on (and break printf/strtod equivalence)
+"%BIN%\arm-none-eabi-g++.exe" -c "%APP%\src\num_format.cpp" -o "%TEMP%\num_format.o" %CFLAGS% -fno-fast-math || goto FAIL
+"%BIN%\arm-none-eabi-g++.exe" -c "%APP%\src\num_parse.cpp" -o "%TEMP%\num_parse.o" %CFLAGS% -fno-fast-math || goto FAIL
+"%BIN%\arm-none-eabi-g++.exe" -c "%APP%\src\str_kernels.cpp" -o "%TEMP%\str_kernels.o" %CFLAGS% || goto FAIL
+"%BIN%\arm-none-eabi-g++.exe" -c "%APP%\src\serial_tx.cpp" -o "%TEMP%\serial_tx.o" %CFLAGS% || goto FAIL
+"%BIN%\arm-none-eabi-g++.exe" -c "%APP%\src\app_log.cpp" -o "%TEMP%\app_log.o" %CFLAGS% || goto FAIL
+"%BIN%\arm-none-eabi-g++.exe" -c "%APP%\src\job_system.cpp" -o "%TEMP%\job_system.o" %CFLAGS% || goto FAIL
 
 if /I "%LIBC%"=="ON" (
   if /I "%VERBOSE%"=="ON" (
@@ -179,8 +195,15 @@ if /I "%LIBC%"=="ON" (
     "%TEMP%\app_sys_raw.o" ^
     "%TEMP%\app_export.o" ^
     "%TEMP%\WString.o" ^
+    "%TEMP%\WStringView.o" ^
     "%TEMP%\WMath.o" ^
     "%TEMP%\arduino_utils.o" ^
+    "%TEMP%\num_format.o" ^
+    "%TEMP%\num_parse.o" ^
+    "%TEMP%\str_kernels.o" ^
+    "%TEMP%\serial_tx.o" ^
+    "%TEMP%\app_log.o" ^
+    "%TEMP%\job_system.o" ^
     %LIBC_OBJ% ^
     -o "%BUILD%\app.elf" %CFLAGS% %LDFLAGS% || goto FAIL
 ) else (
@@ -190,8 +213,15 @@ if /I "%LIBC%"=="ON" (
     "%TEMP%\app_sys_raw.o" ^
     "%TEMP%\app_export.o" ^
     "%TEMP%\WString.o" ^
+    "%TEMP%\WStringView.o" ^
     "%TEMP%\WMath.o" ^
     "%TEMP%\arduino_utils.o" ^
+    "%TEMP%\num_format.o" ^
+    "%TEMP%\num_parse.o" ^
+    "%TEMP%\str_kernels.o" ^
+    "%TEMP%\serial_tx.o" ^
+    "%TEMP%\app_log.o" ^
+    "%TEMP%\job_system.o" ^
     -o "%BUILD%\app.elf" %CFLAGS% %LDFLAGS% || goto FAIL
 )
 
@@ -206,6 +236,12 @@ if /I "%VERBOSE%"=="ON" (
 )
 python "%TOOLS%\page_gen.py" "%BUILD%\app.elf" "%BUILD%\app.bin" "%KERNEL%\src\generated" || goto FAIL
 
+:: Extract the APP_LOG format dictionary for tools\log_decode.py
+if /I "%VERBOSE%"=="ON" (
+  echo   Generating: log dictionary
+)
+python "%TOOLS%\log_gen.py" "%BUILD%\app.elf" "%APP%\src\generated\log_dict.json" || goto FAIL
+
 for %%F in ("%BUILD%\app.bin") do set BIN_SIZE=%%~zF
 if !BIN_SIZE! GEQ 1024 (
   set /a BIN_SIZE_KB=!BIN_SIZE! / 1024
@@ -0,0 +1,166 @@
+#include <Arduino.h>
+#include <stdint.h>
+#include <hardware/adc.h>
+#include <hardware/dma.h>
+#include <hardware/irq.h>
+#include <hardware/sync.h>
+
+#include "adc_stream.h"
+#include "syscall_validation.h"
+#include "kernel_util.h"
+
+// The ADC runs from the 48 MHz USB clock and needs 96 cycles per sample
+#define ADC_CLOCK_HZ 48000000u
+#define ADC_MAX_RATE_HZ (ADC_CLOCK_HZ / 96u)
+#define ADC_CHANNEL_COUNT 5u  // 4 pins + temperature sensor
+
+// DMA_IRQ_0 is left to the Arduino core and libraries
+#define ADC_STREAM_DMA_IRQ DMA_IRQ_1
+
+struct AdcStream {
+  bool running;
+  int dma[2];             // channel filling half 0 / half 1
+  uint16_t* half[2];
+  uint32_t half_len;      // samples per half
+  volatile uint32_t ready;
+  volatile uint32_t overruns;
+};
+
+static AdcStream g_stream = {false, {-1, -1}, {nullptr, nullptr}, 0, 0, 0};
+
+static void adcStreamDmaIrq(void) {
+  for (int i = 0; i < 2; ++i) {
+    const int ch = g_stream.dma[i];
+    if (ch < 0 || !dma_channel_get_irq1_status(ch)) {
+      continue;
+    }
+    dma_channel_acknowledge_irq1(ch);
+    // Re-arm for the next lap; the chain trigger from the other channel
+    // starts it once that half is full
+    dma_channel_set_write_addr(ch, g_stream.half[i], false);
+    const uint32_t bit = 1u << i;
+    if (g_stream.ready & bit) {
+      g_stream.overruns++;
+    }
+    g_stream.ready |= bit;
+  }
+}
+
+static void configureChannel(int ch, int chain_to, uint16_t* dst, uint32_t count) {
+  dma_channel_config c = dma_channel_get_default_config(ch);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+  channel_config_set_read_increment(&c, false);
+  channel_config_set_write_increment(&c, true);
+  channel_config_set_dreq(&c, DREQ_ADC);
+  channel_config_set_chain_to(&c, chain_to);
+  dma_channel_configure(ch, &c, dst, &adc_hw->fifo, count, false);
+}
+
+extern "C" bool adc_stream_start(uint32_t channels_mask, uint32_t rate_hz, uint16_t* buf, size_t len) {
+  channels_mask &= (1u << ADC_CHANNEL_COUNT) - 1u;
+  if (channels_mask == 0 || rate_hz == 0 || rate_hz > ADC_MAX_RATE_HZ) {
+    reportError("ADC_startStream", "bad channel mask or rate");
+    return false;
+  }
+  // adc_gpio_init() would take the pin's digital function away from the radio
+  if (((channels_mask << 26) & kRadioPinMask) != 0) {
+    reportError("ADC_startStream", "channel 3 (GPIO29) is the CYW43 clock");
+    return false;
+  }
+  if (len < 2 || (len & 1u) != 0 ||
+      (reinterpret_cast<uintptr_t>(buf) & 1u) != 0 ||
+      !syscall_validation::isValidAppBuffer(buf, len * sizeof(uint16_t))) {
+    reportError("ADC_startStream", "invalid buffer");
+    return false;
+  }
+  adc_stream_stop();
+
+  int dma0 = dma_claim_unused_channel(false);
+  int dma1 = dma_claim_unused_channel(false);
+  if (dma0 < 0 || dma1 < 0) {
+    if (dma0 >= 0) dma_channel_unclaim(dma0);
+    if (dma1 >= 0) dma_channel_unclaim(dma1);
+    reportError("ADC_startStream", "no free DMA channels");
+    return false;
+  }
+
+  adc_init();
+  uint32_t first = 0;
+  while (((channels_mask >> first) & 1u) == 0) {
+    ++first;
+  }
+  for (uint32_t ch = 0; ch < 4; ++ch) {
+    if (channels_mask & (1u << ch)) {
+      adc_gpio_init(26 + ch);
+    }
+  }
+  adc_set_temp_sensor_enabled((channels_mask & (1u << 4)) != 0);
+  adc_select_input(first);
+  adc_set_round_robin(channels_mask);
+  // DREQ for every sample, no error bit in the data, full 12 bits
+  adc_fifo_setup(true, true, 1, false, false);
+  // One conversion every (1 + div) ADC clocks
+  adc_set_clkdiv(static_cast<float>(ADC_CLOCK_HZ) / static_cast<float>(rate_hz) - 1.0f);
+
+  g_stream.dma[0] = dma0;
+  g_stream.dma[1] = dma1;
+  g_stream.half[0] = buf;
+  g_stream.half[1] = buf + len / 2;
+  g_stream.half_len = len / 2;
+  g_stream.ready = 0;
+  g_stream.overruns = 0;
+
+  configureChannel(dma0, dma1, g_stream.half[0], g_stream.half_len);
+  configureChannel(dma1, dma0, g_stream.half[1], g_stream.half_len);
+  dma_channel_set_irq1_enabled(dma0, true);
+  dma_channel_set_irq1_enabled(dma1, true);
+  irq_add_shared_handler(ADC_STREAM_DMA_IRQ, adcStreamDmaIrq,
+                         PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(ADC_STREAM_DMA_IRQ, true);
+
+  g_stream.running = true;
+  adc_fifo_drain();
+  dma_channel_start(dma0);
+  adc_run(true);
+  return true;
+}
+
+extern "C" void adc_stream_stop(void) {
+  if (!g_stream.running) {
+    return;
+  }
+  adc_run(false);
+  for (int i = 0; i < 2; ++i) {
+    const int ch = g_stream.dma[i];
+    dma_channel_set_irq1_enabled(ch, false);
+    // Chain each channel to itself (= no chain) so that aborting one
+    // cannot trigger the other
+    hw_write_masked(&dma_hw->ch[ch].al1_ctrl,
+                    static_cast<uint32_t>(ch) << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB,
+                    DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+  }
+  for (int i = 0; i < 2; ++i) {
+    const int ch = g_stream.dma[i];
+    dma_channel_abort(ch);
+    dma_channel_acknowledge_irq1(ch);
+    dma_channel_unclaim(ch);
+    g_stream.dma[i] = -1;
+  }
+  adc_fifo_drain();
+  adc_set_round_robin(0);
+  irq_remove_handler(ADC_STREAM_DMA_IRQ, adcStreamDmaIrq);
+  g_stream.running = false;
+}
+
+extern "C" uint32_t adc_stream_poll(void) {
+  uint32_t ready;
+  uint32_t saved = save_and_disable_interrupts();
+  ready = g_stream.ready;
+  g_stream.ready = 0;
+  restore_interrupts(saved);
+  return ready;
+}
+
+extern "C" uint32_t adc_stream_overruns(void) {
+  return g_stream.overruns;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Free-running ADC capture into a double-buffered app buffer.
+//
+// The ADC converts the channels in `channels_mask` round robin at
+// `rate_hz` samples per second in total (up to 500 kS/s; each channel
+// gets rate_hz / channel count). Two chained DMA channels fill the two
+// halves of `buf` (`len` samples of 16 bits, even) alternately, forever,
+// with no CPU involvement besides one interrupt per half.
+//
+// Channels 0-3 are GPIO26-29, channel 4 is the temperature sensor. Channel
+// 3 is refused: GPIO29 is the CYW43 radio's SPI clock on the Pico 2 W.
+// Samples are stored in conversion order, starting with the lowest channel.
+bool adc_stream_start(uint32_t channels_mask, uint32_t rate_hz, uint16_t* buf, size_t len);
+void adc_stream_stop(void);
+
+// Bit 0: first half filled, bit 1: second half filled since the last
+// poll. Polling clears the bits; the app owns a half until the DMA comes
+// back around to it.
+uint32_t adc_stream_poll(void);
+
+// Halves that were filled again before the app polled them
+uint32_t adc_stream_overruns(void);
+
+#ifdef __cplusplus
+}
+#endif
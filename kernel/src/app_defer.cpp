@@ -0,0 +1,133 @@
+#include <Arduino.h>
+#include <stdint.h>
+#include <FreeRTOS.h>
+#include <task.h>
+#include <queue.h>
+#include <hardware/timer.h>
+
+#include "app_defer.h"
+#include "syscall_validation.h"
+#include "kernel_util.h"
+
+struct DeferRecord {
+  uintptr_t handler;
+  uint32_t arg;
+  uint32_t posted_us;
+};
+
+struct DeferStats {
+  uint32_t run;
+  uint32_t dropped;
+  uint32_t min_latency_us;
+  uint32_t max_latency_us;
+  uint64_t total_latency_us;
+  uint32_t max_depth;
+};
+
+static QueueHandle_t g_queue = nullptr;
+static DeferStats g_stats = {};
+static volatile bool g_stats_reset = false;
+
+static void appDeferTask(void*) {
+  syscall_validation::registerAppStack();
+  DeferRecord rec;
+  for (;;) {
+    if (xQueueReceive(g_queue, &rec, portMAX_DELAY) != pdPASS) {
+      continue;
+    }
+    const uint32_t latency = time_us_32() - rec.posted_us;
+
+    // run and the latencies are only written by this task
+    if (g_stats_reset) {
+      g_stats.run = 0;
+      g_stats.min_latency_us = 0;
+      g_stats.max_latency_us = 0;
+      g_stats.total_latency_us = 0;
+      g_stats_reset = false;
+    }
+    if (g_stats.run == 0 || latency < g_stats.min_latency_us) {
+      g_stats.min_latency_us = latency;
+    }
+    if (latency > g_stats.max_latency_us) {
+      g_stats.max_latency_us = latency;
+    }
+    g_stats.total_latency_us += latency;
+    g_stats.run++;
+
+    reinterpret_cast<void (*)(uint32_t)>(rec.handler)(rec.arg);
+  }
+}
+
+extern "C" void app_defer_start(void) {
+  if (g_queue != nullptr) {
+    return;
+  }
+  g_queue = xQueueCreate(APP_DEFER_QUEUE_LEN, sizeof(DeferRecord));
+  // Below Core1Sys, which core 1 spins on, and above all app tasks
+  if (g_queue == nullptr ||
+      xTaskCreate(appDeferTask, "AppDefer", 2048, nullptr, configMAX_PRIORITIES - 2, nullptr) != pdPASS) {
+    Serial.println("[Kernel] ERROR: Could not start the deferred work task");
+  }
+}
+
+extern "C" bool app_defer_queue(uintptr_t handler, uint32_t arg) {
+  if (g_queue == nullptr) {
+    return false;
+  }
+  const DeferRecord rec = {handler, arg, time_us_32()};
+  bool queued;
+  uint32_t depth;
+  if (inInterrupt()) {
+    BaseType_t woken = pdFALSE;
+    queued = xQueueSendFromISR(g_queue, &rec, &woken) == pdPASS;
+    depth = uxQueueMessagesWaitingFromISR(g_queue);
+    portYIELD_FROM_ISR(woken);
+  } else {
+    queued = xQueueSend(g_queue, &rec, 0) == pdPASS;
+    depth = uxQueueMessagesWaiting(g_queue);
+  }
+  // Posts all run on core 0; a nested interrupt may lose an increment
+  if (!queued) {
+    g_stats.dropped++;
+  } else if (depth > g_stats.max_depth) {
+    g_stats.max_depth = depth;
+  }
+  return queued;
+}
+
+extern "C" bool app_defer_post(uintptr_t handler, uint32_t arg) {
+  if (!syscall_validation::isValidAppCode(handler)) {
+    if (!inInterrupt()) {
+      Serial.print("[Kernel] ERROR: Defer_post handler 0x");
+      Serial.print(handler, HEX);
+      Serial.println(" is not app code");
+    }
+    return false;
+  }
+  return app_defer_queue(handler, arg);
+}
+
+extern "C" bool app_defer_get_stats(uint32_t* out) {
+  if (!syscall_validation::isValidAppWritable(out, APP_DEFER_STATS_WORDS * sizeof(uint32_t))) {
+    return false;
+  }
+  taskENTER_CRITICAL();
+  const DeferStats s = g_stats;
+  taskEXIT_CRITICAL();
+  out[0] = s.run;
+  out[1] = s.dropped;
+  out[2] = s.min_latency_us;
+  out[3] = s.max_latency_us;
+  out[4] = s.run ? static_cast<uint32_t>(s.total_latency_us / s.run) : 0;
+  out[5] = s.max_depth;
+  return true;
+}
+
+// The latency figures are cleared by the task before its next handler
+extern "C" void app_defer_reset_stats(void) {
+  taskENTER_CRITICAL();
+  g_stats.dropped = 0;
+  g_stats.max_depth = 0;
+  taskEXIT_CRITICAL();
+  g_stats_reset = true;
+}
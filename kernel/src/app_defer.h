@@ -0,0 +1,47 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Deferred work for app interrupt handlers ("bottom halves").
+//
+// An interrupt posts a small record (handler, arg, timestamp) and returns;
+// the AppDefer task, which runs above every app task and AppTask, calls
+// handler(arg) soon after with full syscall access. Handlers run one at a
+// time in posting order on core 0 and, unlike ISRs, need not be
+// APP_RESIDENT. A long handler still delays the ones queued behind it and
+// all lower-priority tasks.
+//
+// GPIO interrupts attached with attachInterruptDeferred() post
+// APP_DEFER_GPIO_ARG(pin, events) without running any app code in the
+// interrupt. Records that find the queue full are dropped and counted.
+
+#define APP_DEFER_QUEUE_LEN 32
+
+// arg for GPIO handlers: pin in bits 0-7, GPIO_IRQ_EDGE_* events above
+#define APP_DEFER_GPIO_ARG(pin, events) ((uint32_t)(pin) | ((uint32_t)(events) << 8))
+
+// Statistics are copied to the app as APP_DEFER_STATS_WORDS words:
+// handlers run, records dropped, min / max / mean latency in us (post to
+// handler start) and the deepest the queue has been.
+#define APP_DEFER_STATS_WORDS 6
+
+// Create the queue and the AppDefer task; call before app code runs
+void app_defer_start(void);
+
+// Queue handler(arg). Callable from interrupts and tasks; `handler` must
+// be app code. Returns false if the record was dropped.
+bool app_defer_post(uintptr_t handler, uint32_t arg);
+
+// Same, for handlers the kernel has already validated
+bool app_defer_queue(uintptr_t handler, uint32_t arg);
+
+bool app_defer_get_stats(uint32_t* out);
+void app_defer_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,56 @@
+#pragma once
+#include <stdint.h>
+
+// Syscall gate function type - app calls this to invoke kernel functions
+typedef uintptr_t (*SyscallGate)(uint16_t id, uintptr_t a0, uintptr_t a1,
+                                  uintptr_t a2, uintptr_t a3, uintptr_t a4,
+                                  uintptr_t a5, uintptr_t a6, uintptr_t a7,
+                                  uintptr_t a8, uintptr_t a9, uintptr_t a10,
+                                  uintptr_t a11, uintptr_t a12, uintptr_t a13,
+                                  uintptr_t a14, uintptr_t a15, uintptr_t a16,
+                                  uintptr_t a17, uintptr_t a18, uintptr_t a19,
+                                  uintptr_t a20, uintptr_t a21, uintptr_t a22,
+                                  uintptr_t a23, uintptr_t a24, uintptr_t a25,
+                                  uintptr_t a26, uintptr_t a27, uintptr_t a28,
+                                  uintptr_t a29);
+
+// App header structure - placed at start of SRAM app image.
+// Must match the layout in app/src/app_header.c.
+typedef struct AppHeader {
+  uint32_t magic;
+  uint32_t version;
+  void (*app_setup)(void);
+  void (*app_loop)(void);
+  SyscallGate syscall_gate;  // Kernel patches this pointer at runtime
+  void* data_start;          // Start of .data section
+  void* data_end;            // End of .data section
+  void* bss_start;           // Start of BSS section (for zeroing)
+  void* bss_end;             // End of BSS section (for zeroing)
+  uint32_t* bss_marker;      // Pointer to BSS verification marker
+  void (**init_array_start)(void);  // Start of .init_array (global constructors)
+  void (**init_array_end)(void);    // End of .init_array
+  void (**fini_array_start)(void);  // Start of .fini_array (global destructors)
+  void (**fini_array_end)(void);     // End of .fini_array
+  void* resident_start;      // Start of .resident (APP_RESIDENT code, never paged)
+  void* resident_end;        // End of .resident
+  const void* loop_config;   // AppLoopConfig (app_scheduler.h) or NULL for the default
+} AppHeader;
+
+#define kAppMagic (0x41505041u)  // "APPA"
+#define kAppVersion (0x00020003u)  // Bumped for loop scheduling config
+#define kAppBaseAddr (0x20030000u)
+
+inline AppHeader* appHeader() {
+  return reinterpret_cast<AppHeader*>(kAppBaseAddr);
+}
+
+// True if `fn` (a Thumb function address) lies in the app's resident
+// region - the only app code the kernel may call from interrupt context,
+// since overlay pages can be swapped out at any time.
+inline bool appIsResidentCode(uintptr_t fn) {
+  const AppHeader* hdr = appHeader();
+  const uintptr_t addr = fn & ~static_cast<uintptr_t>(1);
+  return (fn & 1u) != 0 &&
+         addr >= reinterpret_cast<uintptr_t>(hdr->resident_start) &&
+         addr < reinterpret_cast<uintptr_t>(hdr->resident_end);
+}
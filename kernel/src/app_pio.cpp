@@ -0,0 +1,377 @@
+#include <Arduino.h>
+#include <stdint.h>
+#include <FreeRTOS.h>
+#include <task.h>
+#include <hardware/pio.h>
+#include <hardware/dma.h>
+#include <hardware/clocks.h>
+
+#include "app_pio.h"
+#include "syscall_validation.h"
+#include "kernel_util.h"
+
+static_assert(sizeof(AppPioProgram) == 12, "AppPioProgram must match app/include/pio_program.h");
+static_assert(sizeof(AppPioSmConfig) == 16, "AppPioSmConfig must match app/include/pio_program.h");
+
+#define APP_PIO_MAX_INSTRUCTIONS 32u
+#define APP_PIO_SM_PER_BLOCK 4
+#define APP_PIO_MAX_SMS (NUM_PIOS * APP_PIO_SM_PER_BLOCK)
+
+struct AppPioProgramSlot {
+  bool used;
+  PIO pio;
+  uint8_t offset;
+  uint8_t length;
+  uint8_t wrap_target;
+  uint8_t wrap;
+  uint8_t sideset_bits;
+  uint8_t sideset_flags;
+  uint8_t users;           // state machines running it
+};
+
+struct AppPioSm {
+  bool used;
+  int32_t program;
+  int dma_tx;              // claimed on first use, kept until release
+  int dma_rx;
+};
+
+static AppPioProgramSlot g_programs[APP_PIO_MAX_PROGRAMS];
+static AppPioSm g_sms[APP_PIO_MAX_SMS];
+
+static PIO pioBlock(uint32_t index) {
+  return pio_get_instance(index);
+}
+
+static AppPioSm* smFromHandle(int32_t sm) {
+  if (sm < 0 || sm >= APP_PIO_MAX_SMS || !g_sms[sm].used) {
+    return nullptr;
+  }
+  return &g_sms[sm];
+}
+
+static inline PIO smPio(int32_t sm) {
+  return pioBlock(static_cast<uint32_t>(sm) / APP_PIO_SM_PER_BLOCK);
+}
+
+static inline uint smIndex(int32_t sm) {
+  return static_cast<uint>(sm) % APP_PIO_SM_PER_BLOCK;
+}
+
+static bool hasFreeSm(PIO pio) {
+  for (uint sm = 0; sm < APP_PIO_SM_PER_BLOCK; ++sm) {
+    if (!pio_sm_is_claimed(pio, sm)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool pinsValid(uint32_t base, uint32_t count) {
+  if (count == 0) {
+    return true;
+  }
+  if (base == APP_PIO_NO_PIN || base + count > NUM_BANK0_GPIOS) {
+    return false;
+  }
+  const uint32_t mask = ((count >= 32 ? 0u : (1u << count)) - 1u) << base;
+  return (mask & kRadioPinMask) == 0;
+}
+
+extern "C" int32_t app_pio_load(const AppPioProgram* program) {
+  if (!syscall_validation::isValidAppPointer(program, sizeof(AppPioProgram))) {
+    reportError("Pio_load", "invalid program pointer");
+    return -1;
+  }
+  const AppPioProgram p = *program;
+  const uint16_t* app_insns = reinterpret_cast<const uint16_t*>(static_cast<uintptr_t>(p.instructions));
+  if (p.length == 0 || p.length > APP_PIO_MAX_INSTRUCTIONS ||
+      p.origin < -1 || p.origin + p.length > static_cast<int>(APP_PIO_MAX_INSTRUCTIONS) ||
+      p.wrap_target > p.wrap || p.wrap >= p.length ||
+      p.sideset_bits + ((p.sideset_flags & APP_PIO_SIDESET_OPT) ? 1 : 0) > 5 ||
+      !syscall_validation::isValidAppPointer(app_insns, p.length * sizeof(uint16_t))) {
+    reportError("Pio_load", "malformed program");
+    return -1;
+  }
+
+  int32_t handle = -1;
+  for (int32_t i = 0; i < APP_PIO_MAX_PROGRAMS; ++i) {
+    if (!g_programs[i].used) {
+      handle = i;
+      break;
+    }
+  }
+  if (handle < 0) {
+    reportError("Pio_load", "too many programs");
+    return -1;
+  }
+
+  // The SDK relocates JMP targets by the load offset while copying
+  uint16_t insns[APP_PIO_MAX_INSTRUCTIONS];
+  for (uint32_t i = 0; i < p.length; ++i) {
+    insns[i] = app_insns[i];
+  }
+  pio_program_t sdk_program = {};
+  sdk_program.instructions = insns;
+  sdk_program.length = p.length;
+  sdk_program.origin = p.origin;
+
+  for (uint32_t block = 0; block < NUM_PIOS; ++block) {
+    PIO pio = pioBlock(block);
+    if (!hasFreeSm(pio) || !pio_can_add_program(pio, &sdk_program)) {
+      continue;
+    }
+    AppPioProgramSlot& slot = g_programs[handle];
+    slot.offset = static_cast<uint8_t>(pio_add_program(pio, &sdk_program));
+    slot.pio = pio;
+    slot.length = p.length;
+    slot.wrap_target = p.wrap_target;
+    slot.wrap = p.wrap;
+    slot.sideset_bits = p.sideset_bits;
+    slot.sideset_flags = p.sideset_flags;
+    slot.users = 0;
+    slot.used = true;
+    return handle;
+  }
+  reportError("Pio_load", "no PIO block has room");
+  return -1;
+}
+
+extern "C" void app_pio_unload(int32_t program) {
+  if (program < 0 || program >= APP_PIO_MAX_PROGRAMS || !g_programs[program].used) {
+    return;
+  }
+  AppPioProgramSlot& slot = g_programs[program];
+  if (slot.users != 0) {
+    reportError("Pio_unload", "program still has state machines");
+    return;
+  }
+  pio_program_t sdk_program = {};
+  sdk_program.length = slot.length;
+  sdk_program.origin = -1;
+  pio_remove_program(slot.pio, &sdk_program, slot.offset);
+  slot.used = false;
+}
+
+extern "C" int32_t app_pio_sm_init(int32_t program, const AppPioSmConfig* config) {
+  if (program < 0 || program >= APP_PIO_MAX_PROGRAMS || !g_programs[program].used) {
+    reportError("Pio_smInit", "invalid program handle");
+    return -1;
+  }
+  if (!syscall_validation::isValidAppPointer(config, sizeof(AppPioSmConfig))) {
+    reportError("Pio_smInit", "invalid config pointer");
+    return -1;
+  }
+  const AppPioSmConfig c = *config;
+  AppPioProgramSlot& prog = g_programs[program];
+  const uint32_t sideset_count = prog.sideset_bits;
+  if (!pinsValid(c.out_base, c.out_count) || !pinsValid(c.set_base, c.set_count) ||
+      !pinsValid(c.sideset_base, sideset_count) || c.set_count > 5 || c.out_count > 32 ||
+      (c.in_base != APP_PIO_NO_PIN && c.in_base >= NUM_BANK0_GPIOS) ||
+      (c.jmp_pin != APP_PIO_NO_PIN && c.jmp_pin >= NUM_BANK0_GPIOS) ||
+      c.pull_threshold > 32 || c.push_threshold > 32 ||
+      ((c.flags & APP_PIO_FIFO_JOIN_TX) && (c.flags & APP_PIO_FIFO_JOIN_RX))) {
+    reportError("Pio_smInit", "invalid pins or config");
+    return -1;
+  }
+
+  float div = 1.0f;
+  if (c.freq_hz != 0) {
+    div = static_cast<float>(clock_get_hz(clk_sys)) / static_cast<float>(c.freq_hz);
+    if (div < 1.0f || div >= 65536.0f) {
+      reportError("Pio_smInit", "frequency out of range");
+      return -1;
+    }
+  }
+
+  PIO pio = prog.pio;
+  const int sm = pio_claim_unused_sm(pio, false);
+  if (sm < 0) {
+    reportError("Pio_smInit", "no free state machine");
+    return -1;
+  }
+
+  pio_sm_config cfg = pio_get_default_sm_config();
+  sm_config_set_wrap(&cfg, prog.offset + prog.wrap_target, prog.offset + prog.wrap);
+  sm_config_set_sideset(&cfg, prog.sideset_bits + ((prog.sideset_flags & APP_PIO_SIDESET_OPT) ? 1 : 0),
+                        (prog.sideset_flags & APP_PIO_SIDESET_OPT) != 0,
+                        (prog.sideset_flags & APP_PIO_SIDESET_PINDIRS) != 0);
+  if (c.out_count != 0) {
+    sm_config_set_out_pins(&cfg, c.out_base, c.out_count);
+  }
+  if (c.set_count != 0) {
+    sm_config_set_set_pins(&cfg, c.set_base, c.set_count);
+  }
+  if (sideset_count != 0) {
+    sm_config_set_sideset_pins(&cfg, c.sideset_base);
+  }
+  if (c.in_base != APP_PIO_NO_PIN) {
+    sm_config_set_in_pins(&cfg, c.in_base);
+  }
+  if (c.jmp_pin != APP_PIO_NO_PIN) {
+    sm_config_set_jmp_pin(&cfg, c.jmp_pin);
+  }
+  sm_config_set_out_shift(&cfg, (c.flags & APP_PIO_OUT_SHIFT_RIGHT) != 0, (c.flags & APP_PIO_AUTOPULL) != 0,
+                          c.pull_threshold ? c.pull_threshold : 32);
+  sm_config_set_in_shift(&cfg, (c.flags & APP_PIO_IN_SHIFT_RIGHT) != 0, (c.flags & APP_PIO_AUTOPUSH) != 0,
+                         c.push_threshold ? c.push_threshold : 32);
+  if (c.flags & APP_PIO_FIFO_JOIN_TX) {
+    sm_config_set_fifo_join(&cfg, PIO_FIFO_JOIN_TX);
+  } else if (c.flags & APP_PIO_FIFO_JOIN_RX) {
+    sm_config_set_fifo_join(&cfg, PIO_FIFO_JOIN_RX);
+  }
+  sm_config_set_clkdiv(&cfg, div);
+
+  // Output groups: hand the pins to this PIO block and drive them
+  const uint8_t bases[3] = {c.out_base, c.set_base, c.sideset_base};
+  const uint8_t counts[3] = {c.out_count, c.set_count, static_cast<uint8_t>(sideset_count)};
+  for (int g = 0; g < 3; ++g) {
+    for (uint32_t i = 0; i < counts[g]; ++i) {
+      pio_gpio_init(pio, bases[g] + i);
+    }
+    if (counts[g] != 0) {
+      pio_sm_set_consecutive_pindirs(pio, sm, bases[g], counts[g], true);
+    }
+  }
+
+  pio_sm_init(pio, sm, prog.offset, &cfg);
+
+  const int32_t handle = static_cast<int32_t>(pio_get_index(pio)) * APP_PIO_SM_PER_BLOCK + sm;
+  g_sms[handle] = {true, program, -1, -1};
+  prog.users++;
+  return handle;
+}
+
+static void releaseDma(int& ch) {
+  if (ch >= 0) {
+    dma_channel_abort(ch);
+    dma_channel_unclaim(ch);
+    ch = -1;
+  }
+}
+
+extern "C" void app_pio_sm_release(int32_t sm) {
+  AppPioSm* s = smFromHandle(sm);
+  if (s == nullptr) {
+    return;
+  }
+  PIO pio = smPio(sm);
+  pio_sm_set_enabled(pio, smIndex(sm), false);
+  releaseDma(s->dma_tx);
+  releaseDma(s->dma_rx);
+  pio_sm_unclaim(pio, smIndex(sm));
+  g_programs[s->program].users--;
+  s->used = false;
+}
+
+extern "C" void app_pio_sm_enable(int32_t sm, bool enable) {
+  if (smFromHandle(sm) != nullptr) {
+    pio_sm_set_enabled(smPio(sm), smIndex(sm), enable);
+  }
+}
+
+extern "C" void app_pio_sm_exec(int32_t sm, uint32_t instruction) {
+  if (smFromHandle(sm) != nullptr) {
+    pio_sm_exec(smPio(sm), smIndex(sm), static_cast<uint>(instruction & 0xFFFFu));
+  }
+}
+
+// Full or empty FIFOs are waited out a tick at a time, so other tasks run
+extern "C" uint32_t app_pio_put(int32_t sm, const uint32_t* data, uint32_t count, uint32_t timeout_ms) {
+  AppPioSm* s = smFromHandle(sm);
+  if (s == nullptr || count == 0 || count > kSramSize / sizeof(uint32_t) ||
+      (s->dma_tx >= 0 && dma_channel_is_busy(s->dma_tx)) ||
+      !syscall_validation::isValidAppPointer(data, count * sizeof(uint32_t))) {
+    return 0;
+  }
+  PIO pio = smPio(sm);
+  const uint idx = smIndex(sm);
+  const uint32_t start = millis();
+  uint32_t done = 0;
+  while (done < count) {
+    if (pio_sm_is_tx_fifo_full(pio, idx)) {
+      if (millis() - start >= timeout_ms) {
+        break;
+      }
+      vTaskDelay(1);
+      continue;
+    }
+    pio_sm_put(pio, idx, data[done++]);
+  }
+  return done;
+}
+
+extern "C" uint32_t app_pio_get(int32_t sm, uint32_t* data, uint32_t count, uint32_t timeout_ms) {
+  AppPioSm* s = smFromHandle(sm);
+  if (s == nullptr || count == 0 || count > kSramSize / sizeof(uint32_t) ||
+      (s->dma_rx >= 0 && dma_channel_is_busy(s->dma_rx)) ||
+      !syscall_validation::isValidAppWritable(data, count * sizeof(uint32_t))) {
+    return 0;
+  }
+  PIO pio = smPio(sm);
+  const uint idx = smIndex(sm);
+  const uint32_t start = millis();
+  uint32_t done = 0;
+  while (done < count) {
+    if (pio_sm_is_rx_fifo_empty(pio, idx)) {
+      if (millis() - start >= timeout_ms) {
+        break;
+      }
+      vTaskDelay(1);
+      continue;
+    }
+    data[done++] = pio_sm_get(pio, idx);
+  }
+  return done;
+}
+
+static bool startDma(int32_t sm, const void* data, uint32_t count, uint32_t size, bool tx, const char* what) {
+  AppPioSm* s = smFromHandle(sm);
+  if (s == nullptr || count == 0 || (size != 1 && size != 2 && size != 4) || count > kSramSize / size ||
+      !syscall_validation::isValidAppBuffer(data, static_cast<size_t>(count) * size)) {
+    reportError(what, "invalid state machine or buffer");
+    return false;
+  }
+  int& ch = tx ? s->dma_tx : s->dma_rx;
+  if (ch < 0) {
+    ch = dma_claim_unused_channel(false);
+    if (ch < 0) {
+      reportError(what, "no free DMA channel");
+      return false;
+    }
+  }
+  if (dma_channel_is_busy(ch)) {
+    reportError(what, "previous transfer still running");
+    return false;
+  }
+  PIO pio = smPio(sm);
+  const uint idx = smIndex(sm);
+  dma_channel_config c = dma_channel_get_default_config(ch);
+  channel_config_set_transfer_data_size(&c, size == 1 ? DMA_SIZE_8 : size == 2 ? DMA_SIZE_16 : DMA_SIZE_32);
+  channel_config_set_read_increment(&c, tx);
+  channel_config_set_write_increment(&c, !tx);
+  channel_config_set_dreq(&c, pio_get_dreq(pio, idx, tx));
+  if (tx) {
+    dma_channel_configure(ch, &c, &pio->txf[idx], data, count, true);
+  } else {
+    dma_channel_configure(ch, &c, const_cast<void*>(data), &pio->rxf[idx], count, true);
+  }
+  return true;
+}
+
+extern "C" bool app_pio_dma_put(int32_t sm, const void* data, uint32_t count, uint32_t size) {
+  return startDma(sm, data, count, size, true, "Pio_dmaPut");
+}
+
+extern "C" bool app_pio_dma_get(int32_t sm, void* data, uint32_t count, uint32_t size) {
+  return startDma(sm, data, count, size, false, "Pio_dmaGet");
+}
+
+extern "C" bool app_pio_dma_busy(int32_t sm) {
+  AppPioSm* s = smFromHandle(sm);
+  if (s == nullptr) {
+    return false;
+  }
+  return (s->dma_tx >= 0 && dma_channel_is_busy(s->dma_tx)) ||
+         (s->dma_rx >= 0 && dma_channel_is_busy(s->dma_rx));
+}
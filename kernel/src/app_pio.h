@@ -0,0 +1,95 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// PIO programs and state machines for the app.
+//
+// Programs are assembled at build time by tools/pio_asm.py from
+// app/pio/*.pio into AppPioProgram records (app/src/generated/
+// pio_programs.h). app_pio_load() copies one into the instruction memory
+// of a PIO block that has room and a free state machine, relocating its
+// jumps; app_pio_sm_init() claims a state machine on that block and
+// configures it from an AppPioSmConfig. Data moves through the FIFOs either
+// by copying (app_pio_put/get, blocking with a timeout) or by DMA from an
+// app buffer (app_pio_dma_put/get, which return at once).
+//
+// PIO blocks, state machines and DMA channels are claimed through the SDK,
+// so the app only gets what the Arduino core and the CYW43 driver left
+// free. Handles are small integers, -1 on failure.
+
+#define APP_PIO_MAX_PROGRAMS 8
+
+// AppPioProgram.sideset_flags
+#define APP_PIO_SIDESET_OPT     0x1u
+#define APP_PIO_SIDESET_PINDIRS 0x2u
+
+// AppPioSmConfig.flags
+#define APP_PIO_OUT_SHIFT_RIGHT 0x01u
+#define APP_PIO_IN_SHIFT_RIGHT  0x02u
+#define APP_PIO_AUTOPULL        0x04u
+#define APP_PIO_AUTOPUSH        0x08u
+#define APP_PIO_FIFO_JOIN_TX    0x10u  // 8-deep TX FIFO, no RX
+#define APP_PIO_FIFO_JOIN_RX    0x20u  // 8-deep RX FIFO, no TX
+
+#define APP_PIO_NO_PIN 0xFFu
+
+// Layout shared with app/include/pio_program.h (the app passes pointers)
+typedef struct {
+  uint32_t instructions;   // const uint16_t* in the app
+  uint8_t length;
+  int8_t origin;           // -1: anywhere
+  uint8_t wrap_target;
+  uint8_t wrap;
+  uint8_t sideset_bits;    // without the enable bit of an optional side-set
+  uint8_t sideset_flags;
+  uint16_t reserved;
+} AppPioProgram;
+
+typedef struct {
+  uint32_t freq_hz;        // state machine clock; 0 runs at clk_sys
+  uint8_t out_base;        // pin groups; APP_PIO_NO_PIN or a count of 0 leaves one unset
+  uint8_t out_count;
+  uint8_t set_base;
+  uint8_t set_count;
+  uint8_t in_base;
+  uint8_t sideset_base;    // count comes from the program
+  uint8_t jmp_pin;
+  uint8_t flags;
+  uint8_t pull_threshold;  // 1..32, 0 = 32
+  uint8_t push_threshold;
+  uint16_t reserved;
+} AppPioSmConfig;
+
+int32_t app_pio_load(const AppPioProgram* program);
+void app_pio_unload(int32_t program);
+
+// Claim a state machine for `program` and configure it, stopped, with its
+// PC at the program start. Output pin groups are switched to PIO and
+// driven as outputs.
+int32_t app_pio_sm_init(int32_t program, const AppPioSmConfig* config);
+void app_pio_sm_release(int32_t sm);
+void app_pio_sm_enable(int32_t sm, bool enable);
+
+// Run one instruction on the state machine, e.g. to preload X or Y
+void app_pio_sm_exec(int32_t sm, uint32_t instruction);
+
+// Copy words into the TX FIFO / out of the RX FIFO, waiting up to
+// timeout_ms for room or data; returns the number of words moved
+uint32_t app_pio_put(int32_t sm, const uint32_t* data, uint32_t count, uint32_t timeout_ms);
+uint32_t app_pio_get(int32_t sm, uint32_t* data, uint32_t count, uint32_t timeout_ms);
+
+// DMA `count` elements of `size` bytes (1, 2 or 4) between an app buffer
+// and the FIFO, paced by the FIFO. The buffer must stay valid (globals or
+// heap) until app_pio_dma_busy() is false.
+bool app_pio_dma_put(int32_t sm, const void* data, uint32_t count, uint32_t size);
+bool app_pio_dma_get(int32_t sm, void* data, uint32_t count, uint32_t size);
+bool app_pio_dma_busy(int32_t sm);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,152 @@
+#include <Arduino.h>
+#include <stdint.h>
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "app_scheduler.h"
+#include "syscall_validation.h"
+#include "kernel_util.h"
+
+struct LoopStats {
+  uint32_t iterations;
+  uint32_t min_period_us;
+  uint32_t max_period_us;
+  uint64_t total_period_us;  // over iterations - 1 periods
+  uint32_t max_busy_us;
+  uint64_t total_busy_us;
+};
+
+static TaskHandle_t g_loop_task = nullptr;
+static volatile uint32_t g_mode = APP_LOOP_DELAY_1MS;
+static volatile uint32_t g_param = 0;
+static volatile bool g_mode_changed = false;
+static LoopStats g_stats = {};
+static volatile bool g_stats_reset = false;
+
+static bool validMode(uint32_t mode, uint32_t param) {
+  switch (mode) {
+    case APP_LOOP_DELAY_1MS:
+    case APP_LOOP_FREE_RUN:
+    case APP_LOOP_EVENT:
+      return true;
+    case APP_LOOP_FIXED_RATE:
+      return param > 0;
+    default:
+      return false;
+  }
+}
+
+static TickType_t msToTicks(uint32_t ms) {
+  TickType_t ticks = pdMS_TO_TICKS(ms);
+  return ticks > 0 ? ticks : 1;
+}
+
+extern "C" void app_scheduler_run(void (*loop)(void), const AppLoopConfig* config) {
+  g_loop_task = xTaskGetCurrentTaskHandle();
+  if (config != nullptr && validMode(config->mode, config->param)) {
+    g_mode = config->mode;
+    g_param = config->param;
+  } else if (config != nullptr) {
+    Serial.println("[Kernel] ERROR: Invalid loop mode in app header, using 1 ms delay");
+  }
+
+  TickType_t last_wake = xTaskGetTickCount();
+  uint64_t last_start = 0;
+  for (;;) {
+    if (g_stats_reset) {
+      g_stats = {};
+      g_stats_reset = false;
+      last_start = 0;
+    }
+
+    const uint64_t start = time_us_64();
+    if (loop != nullptr) {
+      loop();
+    }
+    const uint64_t end = time_us_64();
+
+    // Statistics are only written by this task
+    const uint32_t busy = static_cast<uint32_t>(end - start);
+    g_stats.total_busy_us += busy;
+    if (busy > g_stats.max_busy_us) g_stats.max_busy_us = busy;
+    if (last_start != 0) {
+      const uint32_t period = static_cast<uint32_t>(start - last_start);
+      if (g_stats.iterations == 1 || period < g_stats.min_period_us) g_stats.min_period_us = period;
+      if (period > g_stats.max_period_us) g_stats.max_period_us = period;
+      g_stats.total_period_us += period;
+    }
+    g_stats.iterations++;
+    last_start = start;
+
+    if (g_mode_changed) {
+      g_mode_changed = false;
+      last_wake = xTaskGetTickCount();
+    }
+    switch (g_mode) {
+      case APP_LOOP_FREE_RUN:
+        // Only tasks of the same or higher priority get the core
+        taskYIELD();
+        break;
+      case APP_LOOP_FIXED_RATE:
+        // Deadlines advance by whole periods, so overruns do not drift
+        vTaskDelayUntil(&last_wake, msToTicks(g_param));
+        break;
+      case APP_LOOP_EVENT:
+        ulTaskNotifyTake(pdTRUE, g_param == 0 ? portMAX_DELAY : msToTicks(g_param));
+        break;
+      case APP_LOOP_DELAY_1MS:
+      default:
+        vTaskDelay(pdMS_TO_TICKS(1));
+        break;
+    }
+  }
+}
+
+extern "C" bool app_scheduler_set_mode(uint32_t mode, uint32_t param) {
+  if (!validMode(mode, param)) {
+    Serial.println("[Kernel] ERROR: App_setLoopMode: invalid mode or period");
+    return false;
+  }
+  taskENTER_CRITICAL();
+  g_mode = mode;
+  g_param = param;
+  g_mode_changed = true;
+  taskEXIT_CRITICAL();
+  g_stats_reset = true;
+  // A loop blocked in event mode picks the new mode up right away
+  app_scheduler_wake();
+  return true;
+}
+
+extern "C" void app_scheduler_wake(void) {
+  if (g_loop_task == nullptr) {
+    return;
+  }
+  if (inInterrupt()) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(g_loop_task, &woken);
+    portYIELD_FROM_ISR(woken);
+  } else {
+    xTaskNotifyGive(g_loop_task);
+  }
+}
+
+extern "C" bool app_scheduler_get_stats(uint32_t* out) {
+  if (!syscall_validation::isValidAppWritable(out, APP_LOOP_STATS_WORDS * sizeof(uint32_t))) {
+    return false;
+  }
+  taskENTER_CRITICAL();
+  const LoopStats s = g_stats;
+  taskEXIT_CRITICAL();
+  out[0] = s.iterations;
+  out[1] = s.min_period_us;
+  out[2] = s.max_period_us;
+  out[3] = s.iterations > 1 ? static_cast<uint32_t>(s.total_period_us / (s.iterations - 1)) : 0;
+  out[4] = s.iterations > 0 ? static_cast<uint32_t>(s.total_busy_us / s.iterations) : 0;
+  out[5] = s.max_busy_us;
+  return true;
+}
+
+extern "C" void app_scheduler_reset_stats(void) {
+  g_stats_reset = true;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// How AppTask paces calls to the app's loop(). The values are ABI: the
+// app selects a mode through its header (AppLoopConfig) or App_setLoopMode.
+#define APP_LOOP_DELAY_1MS  0u  // legacy: vTaskDelay(1 ms) after every loop()
+#define APP_LOOP_FREE_RUN   1u  // taskYIELD() only - as fast as loop() allows
+#define APP_LOOP_FIXED_RATE 2u  // every `param` ms, drift-free (vTaskDelayUntil)
+#define APP_LOOP_EVENT      3u  // on App_loopWake(), or after `param` ms (0 = never)
+
+// Optional app header block selecting the initial mode
+typedef struct AppLoopConfig {
+  uint32_t mode;
+  uint32_t param;
+} AppLoopConfig;
+
+// Loop statistics, copied to the app as APP_LOOP_STATS_WORDS words:
+// iterations, min / max / mean period between loop() starts in us (the
+// spread is the jitter), mean and max time spent inside loop() in us.
+#define APP_LOOP_STATS_WORDS 6
+
+// Runs the app loop forever in the calling task (AppTask)
+void app_scheduler_run(void (*loop)(void), const AppLoopConfig* config);
+
+bool app_scheduler_set_mode(uint32_t mode, uint32_t param);
+// Wakes loop() in APP_LOOP_EVENT mode; safe from tasks and interrupts
+void app_scheduler_wake(void);
+bool app_scheduler_get_stats(uint32_t* out);
+void app_scheduler_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
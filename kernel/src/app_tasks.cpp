@@ -0,0 +1,318 @@
+#include <Arduino.h>
+#include <stdint.h>
+#include <FreeRTOS.h>
+#include <task.h>
+#include <queue.h>
+#include <event_groups.h>
+
+#include "app_tasks.h"
+#include "app_header.h"
+#include "syscall_validation.h"
+#include "kernel_util.h"
+
+// Stack sizes are in words, like xTaskCreate
+#define APP_TASK_MIN_STACK 256u
+#define APP_TASK_MAX_STACK 8192u
+// AppTask's level. The kernel workers start one above it (WireAsync at
+// idle+2), so an app task must not go higher or it could starve them.
+#define APP_TASK_MAX_PRIORITY (tskIDLE_PRIORITY + 1)
+
+struct AppTaskSlot {
+  bool used;
+  TaskHandle_t task;
+  uintptr_t entry;
+  uintptr_t arg;
+};
+
+struct AppQueueSlot {
+  QueueHandle_t queue;
+  uint32_t item_size;
+};
+
+static AppTaskSlot g_tasks[APP_MAX_TASKS];
+static AppQueueSlot g_queues[APP_MAX_QUEUES];
+static EventGroupHandle_t g_events[APP_MAX_EVENTS];
+
+static TickType_t toTicks(uint32_t timeout_ms) {
+  return timeout_ms == APP_WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+}
+
+// =====================================================================
+// Tasks
+// =====================================================================
+
+// App entry points may return; the slot is freed and the task deleted
+static void appTaskTrampoline(void* param) {
+  AppTaskSlot* slot = static_cast<AppTaskSlot*>(param);
+  syscall_validation::registerAppStack();
+  reinterpret_cast<void (*)(void*)>(slot->entry)(reinterpret_cast<void*>(slot->arg));
+  taskENTER_CRITICAL();
+  slot->task = nullptr;
+  slot->used = false;
+  taskEXIT_CRITICAL();
+  syscall_validation::unregisterAppStack(xTaskGetCurrentTaskHandle());
+  vTaskDelete(nullptr);
+}
+
+extern "C" int32_t app_task_create(uintptr_t entry, uintptr_t arg, uint32_t stack_words, uint32_t priority) {
+  if (!appIsResidentCode(entry)) {
+    reportError("Task_create", "entry point must be APP_RESIDENT");
+    return -1;
+  }
+  if (stack_words < APP_TASK_MIN_STACK || stack_words > APP_TASK_MAX_STACK) {
+    reportError("Task_create", "stack size out of range");
+    return -1;
+  }
+  if (priority < tskIDLE_PRIORITY + 1) priority = tskIDLE_PRIORITY + 1;
+  if (priority > APP_TASK_MAX_PRIORITY) priority = APP_TASK_MAX_PRIORITY;
+
+  int32_t handle = -1;
+  taskENTER_CRITICAL();
+  for (int32_t i = 0; i < APP_MAX_TASKS; ++i) {
+    if (!g_tasks[i].used) {
+      g_tasks[i].used = true;
+      g_tasks[i].task = nullptr;
+      g_tasks[i].entry = entry;
+      g_tasks[i].arg = arg;
+      handle = i;
+      break;
+    }
+  }
+  taskEXIT_CRITICAL();
+  if (handle < 0) {
+    reportError("Task_create", "too many tasks");
+    return -1;
+  }
+
+  AppTaskSlot& slot = g_tasks[handle];
+  // The new task may run before xTaskCreate returns, so it is given the
+  // slot and publishes nothing itself
+  TaskHandle_t task = nullptr;
+  if (xTaskCreate(appTaskTrampoline, "AppTaskN", stack_words, &slot, priority, &task) != pdPASS) {
+    slot.used = false;
+    reportError("Task_create", "out of memory");
+    return -1;
+  }
+  taskENTER_CRITICAL();
+  if (slot.used && slot.entry == entry) {
+    slot.task = task;
+  }
+  taskEXIT_CRITICAL();
+  return handle;
+}
+
+// Only a task's own call is honoured: deleting another task could stop
+// it inside a syscall that holds a kernel lock (the Wire mutex, say),
+// which would then never be released.
+extern "C" void app_task_delete(int32_t handle) {
+  if (handle < 0 || handle >= APP_MAX_TASKS) {
+    return;
+  }
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  taskENTER_CRITICAL();
+  const bool own = g_tasks[handle].used && g_tasks[handle].task == self;
+  if (own) {
+    g_tasks[handle].used = false;
+    g_tasks[handle].task = nullptr;
+  }
+  taskEXIT_CRITICAL();
+  if (!own) {
+    reportError("Task_delete", "a task can only delete itself");
+    return;
+  }
+  syscall_validation::unregisterAppStack(self);
+  vTaskDelete(nullptr);
+}
+
+extern "C" bool app_task_notify_give(int32_t handle) {
+  if (handle < 0 || handle >= APP_MAX_TASKS) {
+    return false;
+  }
+  TaskHandle_t task = g_tasks[handle].task;
+  if (task == nullptr) {
+    return false;
+  }
+  if (inInterrupt()) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(task, &woken);
+    portYIELD_FROM_ISR(woken);
+  } else {
+    xTaskNotifyGive(task);
+  }
+  return true;
+}
+
+// Note: AppTask's notification is also used by App_loopWake
+extern "C" uint32_t app_task_notify_take(uint32_t timeout_ms) {
+  return ulTaskNotifyTake(pdTRUE, toTicks(timeout_ms));
+}
+
+// =====================================================================
+// Queues (items are copied, like xQueueSend/xQueueReceive)
+// =====================================================================
+
+static AppQueueSlot* queueFromHandle(int32_t handle) {
+  if (handle < 0 || handle >= APP_MAX_QUEUES || g_queues[handle].queue == nullptr) {
+    return nullptr;
+  }
+  return &g_queues[handle];
+}
+
+extern "C" int32_t app_queue_create(uint32_t length, uint32_t item_size) {
+  if (length == 0 || item_size == 0 || length * item_size > 16 * 1024) {
+    reportError("Queue_create", "invalid or too large");
+    return -1;
+  }
+  QueueHandle_t queue = xQueueCreate(length, item_size);
+  if (queue == nullptr) {
+    reportError("Queue_create", "out of memory");
+    return -1;
+  }
+  taskENTER_CRITICAL();
+  for (int32_t i = 0; i < APP_MAX_QUEUES; ++i) {
+    if (g_queues[i].queue == nullptr) {
+      g_queues[i].queue = queue;
+      g_queues[i].item_size = item_size;
+      taskEXIT_CRITICAL();
+      return i;
+    }
+  }
+  taskEXIT_CRITICAL();
+  vQueueDelete(queue);
+  reportError("Queue_create", "too many queues");
+  return -1;
+}
+
+extern "C" void app_queue_delete(int32_t handle) {
+  AppQueueSlot* slot = queueFromHandle(handle);
+  if (slot == nullptr) {
+    return;
+  }
+  QueueHandle_t queue = slot->queue;
+  slot->queue = nullptr;
+  vQueueDelete(queue);
+}
+
+extern "C" bool app_queue_send(int32_t handle, const void* item, uint32_t timeout_ms) {
+  AppQueueSlot* slot = queueFromHandle(handle);
+  if (slot == nullptr || !syscall_validation::isValidAppPointer(item, slot->item_size)) {
+    return false;
+  }
+  if (inInterrupt()) {
+    BaseType_t woken = pdFALSE;
+    bool sent = xQueueSendFromISR(slot->queue, item, &woken) == pdTRUE;
+    portYIELD_FROM_ISR(woken);
+    return sent;
+  }
+  return xQueueSend(slot->queue, item, toTicks(timeout_ms)) == pdTRUE;
+}
+
+extern "C" bool app_queue_receive(int32_t handle, void* item, uint32_t timeout_ms) {
+  AppQueueSlot* slot = queueFromHandle(handle);
+  if (slot == nullptr || !syscall_validation::isValidAppWritable(item, slot->item_size)) {
+    return false;
+  }
+  if (inInterrupt()) {
+    BaseType_t woken = pdFALSE;
+    bool received = xQueueReceiveFromISR(slot->queue, item, &woken) == pdTRUE;
+    portYIELD_FROM_ISR(woken);
+    return received;
+  }
+  return xQueueReceive(slot->queue, item, toTicks(timeout_ms)) == pdTRUE;
+}
+
+extern "C" uint32_t app_queue_count(int32_t handle) {
+  AppQueueSlot* slot = queueFromHandle(handle);
+  if (slot == nullptr) {
+    return 0;
+  }
+  return inInterrupt() ? uxQueueMessagesWaitingFromISR(slot->queue)
+                       : uxQueueMessagesWaiting(slot->queue);
+}
+
+// =====================================================================
+// Event groups (24 usable bits)
+// =====================================================================
+
+// The top byte of an event group is FreeRTOS's own control bits; passing
+// any of them (or waiting on no bits at all) trips a configASSERT
+#define APP_EVENT_BITS 0x00FFFFFFu
+
+static EventGroupHandle_t eventFromHandle(int32_t handle) {
+  if (handle < 0 || handle >= APP_MAX_EVENTS) {
+    return nullptr;
+  }
+  return g_events[handle];
+}
+
+extern "C" int32_t app_event_create(void) {
+  EventGroupHandle_t group = xEventGroupCreate();
+  if (group == nullptr) {
+    reportError("Event_create", "out of memory");
+    return -1;
+  }
+  taskENTER_CRITICAL();
+  for (int32_t i = 0; i < APP_MAX_EVENTS; ++i) {
+    if (g_events[i] == nullptr) {
+      g_events[i] = group;
+      taskEXIT_CRITICAL();
+      return i;
+    }
+  }
+  taskEXIT_CRITICAL();
+  vEventGroupDelete(group);
+  reportError("Event_create", "too many event groups");
+  return -1;
+}
+
+extern "C" void app_event_delete(int32_t handle) {
+  EventGroupHandle_t group = eventFromHandle(handle);
+  if (group == nullptr) {
+    return;
+  }
+  g_events[handle] = nullptr;
+  vEventGroupDelete(group);
+}
+
+extern "C" uint32_t app_event_set(int32_t handle, uint32_t bits) {
+  EventGroupHandle_t group = eventFromHandle(handle);
+  if (group == nullptr) {
+    return 0;
+  }
+  bits &= APP_EVENT_BITS;
+  if (inInterrupt()) {
+#if (INCLUDE_xEventGroupSetBitFromISR == 1) && (configUSE_TIMERS == 1)
+    // Deferred to the timer service task; the new bits are not known yet
+    BaseType_t woken = pdFALSE;
+    xEventGroupSetBitsFromISR(group, bits, &woken);
+    portYIELD_FROM_ISR(woken);
+#endif
+    return 0;
+  }
+  return xEventGroupSetBits(group, bits);
+}
+
+extern "C" uint32_t app_event_clear(int32_t handle, uint32_t bits) {
+  EventGroupHandle_t group = eventFromHandle(handle);
+  if (group == nullptr) {
+    return 0;
+  }
+  bits &= APP_EVENT_BITS;
+  return inInterrupt() ? xEventGroupClearBitsFromISR(group, bits) : xEventGroupClearBits(group, bits);
+}
+
+extern "C" uint32_t app_event_wait(int32_t handle, uint32_t bits, uint32_t flags, uint32_t timeout_ms) {
+  EventGroupHandle_t group = eventFromHandle(handle);
+  if (group == nullptr || inInterrupt()) {
+    return 0;
+  }
+  bits &= APP_EVENT_BITS;
+  if (bits == 0) {
+    reportError("Event_wait", "no bits in 0x00FFFFFF to wait for");
+    return 0;
+  }
+  return xEventGroupWaitBits(group, bits,
+                             (flags & APP_EVENT_CLEAR_ON_EXIT) ? pdTRUE : pdFALSE,
+                             (flags & APP_EVENT_WAIT_ALL) ? pdTRUE : pdFALSE,
+                             toTicks(timeout_ms));
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// App-level FreeRTOS objects: tasks, queues, task notifications and event
+// groups, addressed by small integer handles (-1 = error) so the app never
+// holds kernel pointers.
+//
+// Task entry points must be APP_RESIDENT: a task can be preempted anywhere,
+// and only resident code is guaranteed to stay mapped. FreeRTOS runs on
+// core 0 only in this system (core 1 belongs to the app), so all app tasks
+// share core 0 with AppTask, at its priority (higher requests are
+// clamped). A task ends by returning or by deleting itself; to stop
+// another task, signal it (notification, queue or event bits) and let it
+// return. Timeouts are in ms; APP_WAIT_FOREVER blocks indefinitely.
+// Give/send/set calls also work from interrupt context, where timeouts
+// are ignored.
+
+#define APP_WAIT_FOREVER 0xFFFFFFFFu
+
+#define APP_MAX_TASKS  8
+#define APP_MAX_QUEUES 8
+#define APP_MAX_EVENTS 4
+
+// Event_wait flags
+#define APP_EVENT_WAIT_ALL      0x1u  // all bits instead of any
+#define APP_EVENT_CLEAR_ON_EXIT 0x2u  // clear the bits that satisfied the wait
+
+int32_t app_task_create(uintptr_t entry, uintptr_t arg, uint32_t stack_words, uint32_t priority);
+void app_task_delete(int32_t handle);
+bool app_task_notify_give(int32_t handle);
+uint32_t app_task_notify_take(uint32_t timeout_ms);
+
+int32_t app_queue_create(uint32_t length, uint32_t item_size);
+void app_queue_delete(int32_t handle);
+bool app_queue_send(int32_t handle, const void* item, uint32_t timeout_ms);
+bool app_queue_receive(int32_t handle, void* item, uint32_t timeout_ms);
+uint32_t app_queue_count(int32_t handle);
+
+int32_t app_event_create(void);
+void app_event_delete(int32_t handle);
+uint32_t app_event_set(int32_t handle, uint32_t bits);
+uint32_t app_event_clear(int32_t handle, uint32_t bits);
+uint32_t app_event_wait(int32_t handle, uint32_t bits, uint32_t flags, uint32_t timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,153 @@
+#include <Arduino.h>
+#include <stdint.h>
+#include <hardware/timer.h>
+#include <hardware/sync.h>
+
+#include "app_timer.h"
+#include "app_header.h"
+#include "syscall_validation.h"
+#include "kernel_util.h"
+
+struct AppTimer {
+  bool active;
+  bool claimed;           // alarm stays claimed by this slot once started
+  int alarm;              // TIMER0 alarm number
+  void (*callback)(void);
+  uint32_t period_us;     // 0 for one-shot timers
+  uint64_t target_us;     // deadline the alarm is armed for
+  uint32_t fired;
+  uint32_t missed;
+  uint32_t min_late_us;
+  uint32_t max_late_us;
+  uint64_t total_late_us;
+};
+
+static AppTimer g_timers[APP_TIMER_MAX];
+
+static void appTimerAlarm(uint alarm_num) {
+  AppTimer* t = nullptr;
+  for (int i = 0; i < APP_TIMER_MAX; ++i) {
+    if (g_timers[i].active && g_timers[i].claimed &&
+        g_timers[i].alarm == static_cast<int>(alarm_num)) {
+      t = &g_timers[i];
+      break;
+    }
+  }
+  if (t == nullptr) {
+    return;
+  }
+
+  const uint64_t now = time_us_64();
+  const uint32_t late = static_cast<uint32_t>(now - t->target_us);
+  if (t->fired == 0 || late < t->min_late_us) t->min_late_us = late;
+  if (late > t->max_late_us) t->max_late_us = late;
+  t->total_late_us += late;
+  t->fired++;
+
+  if (t->period_us == 0) {
+    t->active = false;
+  } else {
+    // Fixed rate: the next deadline follows from the previous one, not
+    // from when this callback ran. Deadlines already gone are skipped.
+    t->target_us += t->period_us;
+    while (t->target_us <= now) {
+      t->target_us += t->period_us;
+      t->missed++;
+    }
+    while (hardware_alarm_set_target(alarm_num, from_us_since_boot(t->target_us))) {
+      t->target_us += t->period_us;
+      t->missed++;
+    }
+  }
+
+  t->callback();
+}
+
+static int32_t startTimer(uintptr_t callback, uint32_t interval_us, bool repeating,
+                          const char* what) {
+  if (!appIsResidentCode(callback)) {
+    reportError(what, "callback must be APP_RESIDENT");
+    return -1;
+  }
+  if (interval_us == 0) {
+    reportError(what, "interval must be > 0");
+    return -1;
+  }
+
+  int32_t handle = -1;
+  for (int i = 0; i < APP_TIMER_MAX; ++i) {
+    if (!g_timers[i].active) {
+      handle = i;
+      break;
+    }
+  }
+  if (handle < 0) {
+    reportError(what, "no free timer");
+    return -1;
+  }
+
+  AppTimer& t = g_timers[handle];
+  if (!t.claimed) {
+    t.alarm = hardware_alarm_claim_unused(false);
+    if (t.alarm < 0) {
+      reportError(what, "no free hardware alarm");
+      return -1;
+    }
+    hardware_alarm_set_callback(t.alarm, appTimerAlarm);
+    t.claimed = true;
+  }
+
+  t.callback = reinterpret_cast<void (*)(void)>(callback);
+  t.period_us = repeating ? interval_us : 0;
+  t.fired = 0;
+  t.missed = 0;
+  t.min_late_us = 0;
+  t.max_late_us = 0;
+  t.total_late_us = 0;
+
+  uint32_t saved = save_and_disable_interrupts();
+  t.active = true;
+  t.target_us = time_us_64() + interval_us;
+  while (hardware_alarm_set_target(t.alarm, from_us_since_boot(t.target_us))) {
+    t.target_us += interval_us;
+  }
+  restore_interrupts(saved);
+  return handle;
+}
+
+extern "C" int32_t app_timer_start_repeating(uintptr_t callback, uint32_t period_us) {
+  return startTimer(callback, period_us, true, "Timer_startRepeating");
+}
+
+extern "C" int32_t app_timer_start_once(uintptr_t callback, uint32_t delay_us) {
+  return startTimer(callback, delay_us, false, "Timer_startOnce");
+}
+
+extern "C" void app_timer_stop(int32_t handle) {
+  if (handle < 0 || handle >= APP_TIMER_MAX) {
+    return;
+  }
+  AppTimer& t = g_timers[handle];
+  uint32_t saved = save_and_disable_interrupts();
+  t.active = false;
+  if (t.claimed) {
+    hardware_alarm_cancel(t.alarm);
+  }
+  restore_interrupts(saved);
+}
+
+extern "C" bool app_timer_get_stats(int32_t handle, uint32_t* out) {
+  if (handle < 0 || handle >= APP_TIMER_MAX ||
+      !syscall_validation::isValidAppWritable(out, APP_TIMER_STATS_WORDS * sizeof(uint32_t))) {
+    return false;
+  }
+  const AppTimer& t = g_timers[handle];
+  uint32_t saved = save_and_disable_interrupts();
+  out[0] = t.fired;
+  out[1] = t.missed;
+  out[2] = t.min_late_us;
+  out[3] = t.max_late_us;
+  out[4] = t.fired ? static_cast<uint32_t>(t.total_late_us / t.fired) : 0;
+  restore_interrupts(saved);
+  return true;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Hardware alarm timers that call resident app functions.
+//
+// Each timer owns one TIMER0 hardware alarm, so callbacks run straight
+// from that alarm's interrupt on core 0 with microsecond resolution and
+// no dependency on the app loop or the FreeRTOS tick. Callbacks must be
+// APP_RESIDENT (checked against the app header) and short: they run in
+// interrupt context.
+
+#define APP_TIMER_MAX 3  // TIMER0 has 4 alarms; the SDK alarm pool keeps one
+
+// Statistics are copied to the app as APP_TIMER_STATS_WORDS words:
+// callbacks run, periods skipped because their deadline had passed, and
+// min / max / mean lateness in us (deadline to callback; max - min is the
+// jitter).
+#define APP_TIMER_STATS_WORDS 5
+
+// Return a handle (0..APP_TIMER_MAX-1) or -1
+int32_t app_timer_start_repeating(uintptr_t callback, uint32_t period_us);
+int32_t app_timer_start_once(uintptr_t callback, uint32_t delay_us);
+void app_timer_stop(int32_t handle);
+bool app_timer_get_stats(int32_t handle, uint32_t* out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -2,6 +2,9 @@
 #include <stdint.h>
 #include <string.h>
 #include <limits.h>
+#include <hardware/sync.h>
+#include <hardware/exception.h>
+#include <hardware/timer.h>
 
 #include "generated/raw_data.h"
 #include "generated/app_page_map.h"
@@ -20,54 +23,122 @@ extern "C" {
 #endif
 
 // Code overlay configuration
-// Fixed code execution window where all code pages are loaded
-// Pages overlay each other in this window - only one set active at a time
+// Fixed code execution window; the app's .text is linked here and each code
+// page is copied to its own linked address (app_page_map sram_addr)
 #define CODE_OVERLAY_BASE (0x20040000)  // Fixed overlay address (matches linker)
 #define CODE_OVERLAY_SIZE (256 * 1024)  // 256KB overlay window
 #define CODE_OVERLAY_END (CODE_OVERLAY_BASE + CODE_OVERLAY_SIZE)
 
 // Page size must match page_gen.py
 #define PAGE_SIZE 4096
-// With overlay, we can have unlimited pages (they overlay each other)
-// But we track which pages are currently loaded for LRU eviction
-#define MAX_CACHED_PAGES 64  // Track up to 64 pages (can be increased if needed)
+// Tracking slots for code pages; evicted pages give their slot back but
+// stay in the window (see code_cache.h)
+#define MAX_CACHED_PAGES 64
+
+// Fill for code that has never been loaded: UDF #0xDE in every halfword,
+// so running into such a page raises a UsageFault that loads it
+#define CODE_POISON_WORD 0xDEDEDEDEu
+#define CODE_POISON_HALF 0xDEDEu
+
+// Cortex-M33 fault registers (banked per core)
+#define SCB_SHCSR (*(volatile uint32_t*)0xE000ED24u)
+#define SCB_CFSR  (*(volatile uint32_t*)0xE000ED28u)
+#define SHCSR_MEMFAULTENA (1u << 16)
+#define SHCSR_USGFAULTENA (1u << 18)
+#define CFSR_IACCVIOL     (1u << 0)
+#define CFSR_UNDEFINSTR   (1u << 16)
+
+// Cortex-M33 MPU (banked per core)
+#define MPU_TYPE  (*(volatile uint32_t*)0xE000ED90u)
+#define MPU_CTRL  (*(volatile uint32_t*)0xE000ED94u)
+#define MPU_RNR   (*(volatile uint32_t*)0xE000ED98u)
+#define MPU_RBAR  (*(volatile uint32_t*)0xE000ED9Cu)
+#define MPU_RLAR  (*(volatile uint32_t*)0xE000EDA0u)
+#define MPU_MAIR0 (*(volatile uint32_t*)0xE000EDC0u)
+#define MPU_CTRL_ENABLE     (1u << 0)
+#define MPU_CTRL_PRIVDEFENA (1u << 2)
+#define MPU_RBAR_XN         (1u << 0)   // AP = 00: privileged read/write
+#define MPU_RLAR_EN         (1u << 0)   // AttrIndx 0
+#define MPU_MAX_REGIONS 8
 
 // Page cache entry
 struct PageCacheEntry {
   uint32_t page_id;
   bool loaded;
+  uint8_t owner;        // core whose slot budget this page counts against
+  uint16_t refcount;    // pins; pinned pages are never evicted
   uint32_t cache_addr;  // Address in code cache
-  uint32_t access_count;  // For LRU eviction
+  uint32_t last_use;    // For LRU eviction
 };
 
 static PageCacheEntry page_cache[MAX_CACHED_PAGES];
-static uint32_t loaded_page_count = 0;
-// Overlay: all code pages load into the same fixed window
-// We track which pages are loaded, but they all use CODE_OVERLAY_BASE
+static uint32_t use_clock = 0;
+
+// Guards everything above. Held with interrupts off on the holding core,
+// including while a page is copied, so the other core cannot observe a
+// half-loaded page through the tracking table.
+static spin_lock_t* cache_lock = nullptr;
+
+// Slot budget per core (0 = shared) and slots currently held
+static uint32_t core_quota[2] = {0, 0};
+static uint32_t core_used[2] = {0, 0};
+static CodeCacheStats core_stats[2];
+
+// Pages whose bytes are valid in the window. Eviction only drops tracking,
+// so a page stays present once loaded and this set only grows; present_gen
+// counts the changes. Each core's MPU marks the pages that are not present
+// execute-never, and mpu_gen records which set it was programmed for.
+static uint32_t present_bits[(APP_PAGE_COUNT + 31) / 32 + 1];
+static uint32_t present_gen = 0;
+static uint32_t mpu_gen[2] = {0, 0};
+static bool mpu_owned[2] = {false, false};
 
+// End of the highest code page, set from the page map by code_cache_init()
+static uint32_t code_end = CODE_OVERLAY_BASE;
 
-// ARM interrupt control
-static inline void cpsid_i() { __asm__("cpsid i"); }
-static inline void cpsie_i() { __asm__("cpsie i"); }
+static void mpu_sync(uint32_t core);
+
+// Memory barriers to ensure writes complete before execution
 static inline void dsb() { __asm__("dsb 0xF"); }
 static inline void isb() { __asm__("isb 0xF"); }
 
+static inline bool is_code_page(const AppPageInfo* page) {
+  return page->section_id == 1;
+}
+
 // Initialize code overlay
 void code_cache_init(void) {
+  if (cache_lock == nullptr) {
+    cache_lock = spin_lock_instance(spin_lock_claim_unused(true));
+  }
+  uint32_t save = spin_lock_blocking(cache_lock);
   memset(page_cache, 0, sizeof(page_cache));
-  loaded_page_count = 0;
-  
-  // Zero the overlay region to ensure clean state
-  uint32_t* zero_ptr = reinterpret_cast<uint32_t*>(CODE_OVERLAY_BASE);
-  uint32_t zero_words = CODE_OVERLAY_SIZE / 4;
-  cpsid_i();
-  for (uint32_t i = 0; i < zero_words; i++) {
-    zero_ptr[i] = 0;
-  }
-  cpsie_i();
+  memset(core_stats, 0, sizeof(core_stats));
+  core_quota[0] = core_quota[1] = 0;
+  core_used[0] = core_used[1] = 0;
+  use_clock = 0;
+  memset(present_bits, 0, sizeof(present_bits));
+  present_gen++;
+  code_end = CODE_OVERLAY_BASE;
+  for (uint32_t i = 0; i < APP_PAGE_COUNT; i++) {
+    const AppPageInfo* page = &app_page_map[i];
+    if (is_code_page(page) && page->sram_addr + page->size > code_end) {
+      code_end = page->sram_addr + page->size;
+    }
+  }
+
+  // Poison the overlay region so stale or missing code faults instead of running
+  uint32_t* poison_ptr = reinterpret_cast<uint32_t*>(CODE_OVERLAY_BASE);
+  uint32_t poison_words = CODE_OVERLAY_SIZE / 4;
+  for (uint32_t i = 0; i < poison_words; i++) {
+    poison_ptr[i] = CODE_POISON_WORD;
+  }
   dsb();
   isb();
-  
+  spin_unlock(cache_lock, save);
+
+  code_cache_enable_demand_paging();
+
   // Load critical pages immediately (page 0 = header, page 1 = setup/loop)
   // Note: Header/data pages load at fixed addresses, not in overlay
   for (uint32_t i = 0; i < APP_PAGE_COUNT && i < 2; i++) {
@@ -75,7 +146,7 @@ void code_cache_init(void) {
   }
 }
 
-// Find cache entry by page ID
+// Find cache entry by page ID (lock held)
 static PageCacheEntry* find_cache_entry(uint32_t page_id) {
   for (uint32_t i = 0; i < MAX_CACHED_PAGES; i++) {
     if (page_cache[i].loaded && page_cache[i].page_id == page_id) {
@@ -85,7 +156,7 @@ static PageCacheEntry* find_cache_entry(uint32_t page_id) {
   return nullptr;
 }
 
-// Find free cache slot
+// Find free cache slot (lock held)
 static PageCacheEntry* find_free_slot(void) {
   for (uint32_t i = 0; i < MAX_CACHED_PAGES; i++) {
     if (!page_cache[i].loaded) {
@@ -95,147 +166,101 @@ static PageCacheEntry* find_free_slot(void) {
   return nullptr;
 }
 
-// Evict least recently used page from overlay
-static void evict_lru_page(void) {
+// Drop tracking of the least recently used unpinned page (lock held). With
+// a partition, a core only evicts its own entries. The page stays present;
+// this only frees a slot and counts the eviction.
+static PageCacheEntry* evict_lru_page(uint32_t core) {
+  const bool partitioned = core_quota[0] != 0;
   PageCacheEntry* lru = nullptr;
-  uint32_t min_access = UINT32_MAX;
-  
-  // Find code page (in overlay) with minimum access count
-  // Don't evict header/data pages (they're at fixed addresses)
-  // Don't evict critical pages (0-1)
+
   for (uint32_t i = 0; i < MAX_CACHED_PAGES; i++) {
     PageCacheEntry* entry = &page_cache[i];
-    if (entry->loaded && entry->page_id >= 2) {
-      const AppPageInfo* page = &app_page_map[entry->page_id];
-      // Only evict code pages (section_id == 1) from overlay
-      if (page->section_id == 1 && entry->access_count < min_access) {
-        min_access = entry->access_count;
-        lru = entry;
-      }
+    if (!entry->loaded || entry->refcount != 0) {
+      continue;
+    }
+    if (partitioned && entry->owner != core) {
+      continue;
+    }
+    if (lru == nullptr || (int32_t)(entry->last_use - lru->last_use) < 0) {
+      lru = entry;
     }
   }
-  
+
   if (lru) {
-    // Mark as unloaded (page will be overwritten when another page loads)
+    // The page's bytes stay in place (code never changes, and nothing else
+    // is copied over them), so the other core may still be running it.
+    // Re-poisoning here could tear a 32-bit instruction mid-fetch.
     lru->loaded = false;
-    loaded_page_count--;
-    
-    // Note: We don't zero the overlay region here because:
-    // 1. Next page load will overwrite it anyway
-    // 2. Zeroing is expensive and not necessary for overlay
-    // The overlay naturally gets overwritten when new pages load
+    core_used[lru->owner]--;
+    core_stats[core].evictions++;
   }
+  return lru;
 }
 
-// Load a page into code overlay window
-// All code pages load into the same fixed overlay region, overlaying previous pages
-bool code_cache_load_page(uint32_t page_id, bool critical) {
-  // Handle case where page map isn't available yet
-  if (APP_PAGE_COUNT == 0 || page_id >= APP_PAGE_COUNT) {
-    return false;
-  }
-  
+enum LoadResult { kLoadOk, kLoadInvalid, kLoadNoSlot };
+
+static inline bool page_present(uint32_t page_id) {
+  return (present_bits[page_id / 32] & (1u << (page_id % 32))) != 0;
+}
+
+// A Thumb halfword that starts a 32-bit instruction
+static inline bool is_wide_prefix(uint16_t hw) {
+  return (hw >> 11) >= 0x1D;
+}
+
+// Load (or find) a code page and optionally pin it (lock held). When the
+// page ends on the first half of a 32-bit instruction, the next page is
+// loaded too, whichever path asked for this one.
+static LoadResult load_locked(uint32_t page_id, bool pin, uint32_t core) {
   const AppPageInfo* page_info = &app_page_map[page_id];
-  
-  // Header and data pages are NOT loaded through overlay - they're at fixed addresses
-  // Only code pages (section_id == 1) use the overlay
-  if (page_info->section_id == 0 || page_info->section_id == 2) {
-    // Header/data pages are loaded directly at fixed addresses by load_app_image_to_sram()
-    // Just mark as "loaded" in cache tracking
-    PageCacheEntry* existing = find_cache_entry(page_id);
-    if (existing) {
-      existing->access_count++;
-      return true;
-    }
-    
-    // Add to cache tracking (but don't actually load - it's already loaded)
-    PageCacheEntry* slot = find_free_slot();
-    if (slot) {
-      slot->page_id = page_id;
-      slot->loaded = true;
-      slot->cache_addr = page_info->sram_addr;  // Fixed address
-      slot->access_count = 1;
-      loaded_page_count++;
-    }
-    return true;
-  }
-  
-  // Code pages: check if already loaded in overlay
+
   PageCacheEntry* existing = find_cache_entry(page_id);
   if (existing) {
-    existing->access_count++;
-    return true;  // Already in overlay
-  }
-  
-  // Evict if cache tracking is full (unless critical)
-  if (loaded_page_count >= MAX_CACHED_PAGES && !critical) {
-    evict_lru_page();
-  }
-  
-  // Find free slot for tracking
-  PageCacheEntry* slot = find_free_slot();
-  if (!slot) {
-    // Force eviction even for critical pages if absolutely necessary
-    evict_lru_page();
+    existing->last_use = ++use_clock;
+    if (pin) existing->refcount++;
+    core_stats[core].hits++;
+    return kLoadOk;
+  }
+
+  if (page_info->sram_addr < CODE_OVERLAY_BASE ||
+      page_info->sram_addr + page_info->size > CODE_OVERLAY_END) {
+    return kLoadInvalid;
+  }
+
+  // Stay within this core's budget, then find a slot
+  PageCacheEntry* slot = nullptr;
+  if (core_quota[0] != 0 && core_used[core] >= core_quota[core]) {
+    slot = evict_lru_page(core);
+  }
+  if (slot == nullptr) {
     slot = find_free_slot();
-    if (!slot) {
-      Serial.print("[Overlay] ERROR: No free tracking slots for page ");
-      Serial.println(page_id);
-      return false;
-    }
   }
-  
-  // CODE OVERLAY: All code pages load into the fixed overlay window
-  // Since code is compiled for overlay region (0x20040000), all pages load at base
-  // Pages naturally overlay each other - only one set active at a time
-  uint32_t sram_addr = CODE_OVERLAY_BASE;
-  
-  // CRITICAL: Invalidate all other code pages in overlay since they get overwritten
-  // Only one code page can be in the overlay at a time
-  // Note: We do this BEFORE using slot to avoid invalidating the slot we're about to use
-  for (uint32_t i = 0; i < MAX_CACHED_PAGES; i++) {
-    PageCacheEntry* entry = &page_cache[i];
-    if (entry->loaded && entry->cache_addr >= CODE_OVERLAY_BASE) {
-      const AppPageInfo* other_page = &app_page_map[entry->page_id];
-      if (other_page->section_id == 1 && entry->page_id != page_id) {  // Code page, not this one
-        entry->loaded = false;
-        loaded_page_count--;
-      }
-    }
+  if (slot == nullptr) {
+    slot = evict_lru_page(core);
   }
-  
-  // Ensure page fits in overlay
-  if (page_info->size > CODE_OVERLAY_SIZE) {
-    Serial.print("[Overlay] WARNING: Page ");
-    Serial.print(page_id);
-    Serial.print(" (");
-    Serial.print(page_info->size);
-    Serial.println(" bytes) exceeds overlay size");
-    return false;
+  if (slot == nullptr) {
+    return kLoadNoSlot;
   }
-  
-  // Copy page from flash to SRAM at original address
+
+  // Copy page from flash to SRAM at its linked address
   const uint8_t* src = raw_data + page_info->flash_offset;
-  uint8_t* dst = reinterpret_cast<uint8_t*>(sram_addr);
+  uint8_t* dst = reinterpret_cast<uint8_t*>(page_info->sram_addr);
   uint32_t size = page_info->size;
-  
+
   // Ensure source is valid
   if (page_info->flash_offset + size > raw_data_len) {
     size = raw_data_len - page_info->flash_offset;
     if (size == 0) {
-      return false;
+      return kLoadInvalid;
     }
   }
-  
-  // Copy with interrupts disabled for safety
-  cpsid_i();
-  
+
   // Align to 4 bytes for faster word copies
   while (((reinterpret_cast<uintptr_t>(dst) & 3u) != 0) && size != 0) {
     *dst++ = *src++;
     --size;
   }
-  
+
   // Fast 32-bit word copies
   const uint32_t* s32 = reinterpret_cast<const uint32_t*>(src);
   uint32_t* d32 = reinterpret_cast<uint32_t*>(dst);
@@ -243,27 +268,102 @@ bool code_cache_load_page(uint32_t page_id, bool critical) {
     *d32++ = *s32++;
     size -= 4;
   }
-  
+
   // Copy remaining bytes
   src = reinterpret_cast<const uint8_t*>(s32);
   dst = reinterpret_cast<uint8_t*>(d32);
   while (size-- != 0) {
     *dst++ = *src++;
   }
-  
-  cpsie_i();
+
   dsb();
   isb();
-  
-  // Update cache entry - use the slot we found earlier
-  // (It's guaranteed to be free since we invalidated other code pages)
+
+  if ((present_bits[page_id / 32] & (1u << (page_id % 32))) == 0) {
+    present_bits[page_id / 32] |= 1u << (page_id % 32);
+    present_gen++;
+  }
+
   slot->page_id = page_id;
   slot->loaded = true;
-  slot->cache_addr = sram_addr;  // Overlay address
-  slot->access_count = 1;
-  
-  loaded_page_count++;
-  
+  slot->owner = (uint8_t)core;
+  slot->refcount = pin ? 1 : 0;
+  slot->cache_addr = page_info->sram_addr;
+  slot->last_use = ++use_clock;
+  core_used[core]++;
+  core_stats[core].loads++;
+
+  const uint32_t last = page_info->sram_addr + page_info->size - 2;
+  if (page_id + 1 < APP_PAGE_COUNT && is_code_page(&app_page_map[page_id + 1]) &&
+      !page_present(page_id + 1) && is_wide_prefix(*reinterpret_cast<const uint16_t*>(last))) {
+    load_locked(page_id + 1, false, core);
+  }
+  return kLoadOk;
+}
+
+static bool load_page(uint32_t page_id, bool pin) {
+  // Handle case where page map isn't available yet
+  if (APP_PAGE_COUNT == 0 || page_id >= APP_PAGE_COUNT || cache_lock == nullptr) {
+    return false;
+  }
+
+  // Header and data pages are NOT loaded through overlay - they're copied to
+  // fixed addresses by load_app_image_to_sram() and never leave
+  if (!is_code_page(&app_page_map[page_id])) {
+    return true;
+  }
+
+  const uint32_t core = get_core_num();
+  uint32_t save = spin_lock_blocking(cache_lock);
+  LoadResult result = load_locked(page_id, pin, core);
+  const bool remap = mpu_owned[core] && mpu_gen[core] != present_gen;
+  spin_unlock(cache_lock, save);
+
+  // Map the new page here right away; the other core catches up on its
+  // next fault in that page
+  if (remap) {
+    mpu_sync(core);
+  }
+
+  // Core 1 runs without the kernel's Serial; report from core 0 only
+  if (result != kLoadOk && core == 0) {
+    Serial.print("[Overlay] ERROR: Cannot load page ");
+    Serial.print(page_id);
+    Serial.println(result == kLoadNoSlot ? " (all slots pinned)" : " (outside overlay window)");
+  }
+  return result == kLoadOk;
+}
+
+// Load a page into the code overlay window
+bool code_cache_load_page(uint32_t page_id, bool critical) {
+  return load_page(page_id, critical);
+}
+
+bool code_cache_pin(uint32_t page_id) {
+  return load_page(page_id, true);
+}
+
+void code_cache_unpin(uint32_t page_id) {
+  if (cache_lock == nullptr) {
+    return;
+  }
+  uint32_t save = spin_lock_blocking(cache_lock);
+  PageCacheEntry* entry = find_cache_entry(page_id);
+  if (entry && entry->refcount != 0) {
+    entry->refcount--;
+  }
+  spin_unlock(cache_lock, save);
+}
+
+bool code_cache_set_partition(uint32_t core0_slots) {
+  if (core0_slots >= MAX_CACHED_PAGES || cache_lock == nullptr) {
+    return false;
+  }
+  // Pages over a core's new budget are evicted by its next loads
+  uint32_t save = spin_lock_blocking(cache_lock);
+  core_quota[0] = core0_slots;
+  core_quota[1] = core0_slots == 0 ? 0 : MAX_CACHED_PAGES - core0_slots;
+  spin_unlock(cache_lock, save);
   return true;
 }
 
@@ -272,31 +372,21 @@ uint32_t code_cache_get_addr(uint32_t page_id) {
   if (APP_PAGE_COUNT == 0 || page_id >= APP_PAGE_COUNT) {
     return 0;
   }
-  
-  PageCacheEntry* entry = find_cache_entry(page_id);
-  if (entry) {
-    entry->access_count++;
-    return entry->cache_addr;
-  }
-  
-  // Load page on demand
-  if (code_cache_load_page(page_id, false)) {
-    entry = find_cache_entry(page_id);
-    if (entry) {
-      return entry->cache_addr;
-    }
-  }
-  
-  return 0;  // Error
+  // Pages always live at their linked address once present
+  return load_page(page_id, false) ? app_page_map[page_id].sram_addr : 0;
 }
 
 // Find page ID for an address
 // For overlay: map overlay addresses to page IDs using the page map's sram_addr
+uint32_t code_cache_code_end(void) {
+  return code_end;
+}
+
 uint32_t code_cache_find_page(uint32_t addr) {
   if (APP_PAGE_COUNT == 0) {
     return UINT32_MAX;
   }
-  
+
   // Check if address is in overlay region
   if (addr >= CODE_OVERLAY_BASE && addr < CODE_OVERLAY_END) {
     // Code pages are compiled for overlay region, so their sram_addr in page map
@@ -311,7 +401,7 @@ uint32_t code_cache_find_page(uint32_t addr) {
       }
     }
   }
-  
+
   // Check fixed address regions (header/data)
   for (uint32_t i = 0; i < APP_PAGE_COUNT; i++) {
     const AppPageInfo* page = &app_page_map[i];
@@ -322,7 +412,7 @@ uint32_t code_cache_find_page(uint32_t addr) {
       }
     }
   }
-  
+
   return UINT32_MAX;
 }
 
@@ -331,7 +421,7 @@ void code_cache_preload_pages(const uint32_t* page_ids, uint32_t count) {
   if (APP_PAGE_COUNT == 0) {
     return;
   }
-  
+
   for (uint32_t i = 0; i < count; i++) {
     if (page_ids[i] < APP_PAGE_COUNT) {
       code_cache_load_page(page_ids[i], false);
@@ -339,7 +429,233 @@ void code_cache_preload_pages(const uint32_t* page_ids, uint32_t count) {
   }
 }
 
+// =====================================================================
+// Fault-driven loading
+// =====================================================================
+//
+// Two ways to notice a jump into a page that is not present:
+//  - MemManage: the MPU marks runs of absent pages execute-never, so the
+//    fetch itself faults. Up to 8 runs can be covered per core.
+//  - UsageFault: absent pages are full of UDF, which catches any run the
+//    MPU has no region left for (or all of them if the MPU is in use by
+//    someone else).
+// Either way the page is loaded on the faulting core and the instruction
+// is retried; loaded code runs with no checks at all.
+
+// Previous HardFault vector; faults that are not page misses go there
+extern "C" void (*code_cache_prev_fault)(void);
+void (*code_cache_prev_fault)(void) = nullptr;
+static bool fault_handlers_installed = false;
+
+struct MpuRun {
+  uint32_t base;
+  uint32_t end;  // exclusive
+};
+
+// Reprogram this core's MPU from the present set. Regions cannot overlap
+// and privileged code keeps the default map elsewhere (PRIVDEFENA), so each
+// region covers one run of absent code pages; the largest runs win.
+static void mpu_sync(uint32_t core) {
+  MpuRun runs[MPU_MAX_REGIONS];
+  uint32_t count = 0;
+  if (cache_lock == nullptr) {
+    return;
+  }
+
+  uint32_t save = spin_lock_blocking(cache_lock);
+  const uint32_t gen = present_gen;
+  uint32_t i = 0;
+  while (i < APP_PAGE_COUNT) {
+    if (!is_code_page(&app_page_map[i]) || page_present(i)) {
+      i++;
+      continue;
+    }
+    MpuRun run = {app_page_map[i].sram_addr, app_page_map[i].sram_addr + app_page_map[i].size};
+    for (i++; i < APP_PAGE_COUNT && is_code_page(&app_page_map[i]) && !page_present(i) &&
+              app_page_map[i].sram_addr == run.end;
+         i++) {
+      run.end += app_page_map[i].size;
+    }
+    if (count < MPU_MAX_REGIONS) {
+      runs[count++] = run;
+      continue;
+    }
+    uint32_t smallest = 0;
+    for (uint32_t r = 1; r < count; r++) {
+      if (runs[r].end - runs[r].base < runs[smallest].end - runs[smallest].base) {
+        smallest = r;
+      }
+    }
+    if (run.end - run.base > runs[smallest].end - runs[smallest].base) {
+      runs[smallest] = run;
+    }
+  }
+  spin_unlock(cache_lock, save);
+
+  // Off while the regions change; everything here runs from flash
+  MPU_CTRL = 0;
+  dsb();
+  isb();
+  for (uint32_t r = 0; r < MPU_MAX_REGIONS; r++) {
+    MPU_RNR = r;
+    if (r < count) {
+      MPU_RBAR = (runs[r].base & ~31u) | MPU_RBAR_XN;
+      MPU_RLAR = ((runs[r].end - 1) & ~31u) | MPU_RLAR_EN;
+    } else {
+      MPU_RLAR = 0;
+    }
+  }
+  MPU_CTRL = MPU_CTRL_ENABLE | MPU_CTRL_PRIVDEFENA;
+  dsb();
+  isb();
+  mpu_gen[core] = gen;
+}
+
+// Make the page holding `pc` present (lock held); load_locked() brings in
+// the next page if an instruction straddles into it
+static bool resolve_miss_locked(uint32_t pc, uint32_t core) {
+  const uint32_t page_id = code_cache_find_page(pc);
+  if (page_id == UINT32_MAX || !is_code_page(&app_page_map[page_id])) {
+    return false;
+  }
+  return page_present(page_id) || load_locked(page_id, false, core) == kLoadOk;
+}
+
+static void record_stall(uint32_t core, uint32_t start_us) {
+  const uint32_t stall_us = time_us_32() - start_us;
+  core_stats[core].faults++;
+  core_stats[core].stall_us += stall_us;
+  if (stall_us > core_stats[core].max_stall_us) {
+    core_stats[core].max_stall_us = stall_us;
+  }
+}
+
+// UsageFault with the stacked exception frame. Returns true if it was a
+// fetch of poison from a page that is not present; the page is then loaded
+// and the instruction retried.
+extern "C" bool code_cache_usage_fault(const uint32_t* frame) {
+  const uint32_t start_us = time_us_32();
+  const uint32_t pc = frame[6];
+  if ((SCB_CFSR & CFSR_UNDEFINSTR) == 0 || pc < CODE_OVERLAY_BASE || pc >= CODE_OVERLAY_END ||
+      cache_lock == nullptr) {
+    return false;
+  }
+
+  const uint32_t core = get_core_num();
+  bool handled = false;
+  uint32_t save = spin_lock_blocking(cache_lock);
+  const uint16_t hw = *reinterpret_cast<volatile const uint16_t*>(pc);
+  if ((hw & 0xFF00u) != 0xDE00u) {
+    // No longer a UDF: the other core loaded the page before we got the lock
+    handled = true;
+  } else if (hw == CODE_POISON_HALF) {
+    const uint32_t page_id = code_cache_find_page(pc);
+    if (page_id != UINT32_MAX && !page_present(page_id)) {
+      handled = resolve_miss_locked(pc, core);
+    }
+  }
+  // Otherwise the page is present and holds a real UDF - not ours
+  if (handled) {
+    SCB_CFSR = CFSR_UNDEFINSTR;  // write one to clear
+    record_stall(core, start_us);
+  }
+  const bool remap = handled && mpu_owned[core] && mpu_gen[core] != present_gen;
+  spin_unlock(cache_lock, save);
+
+  if (remap) {
+    mpu_sync(core);
+  }
+  return handled;
+}
+
+// MemManage with the stacked exception frame. An instruction access
+// violation inside the window means this core's MPU still marks the page
+// absent: load it if needed, remap, and retry.
+extern "C" bool code_cache_mem_fault(const uint32_t* frame) {
+  const uint32_t start_us = time_us_32();
+  const uint32_t pc = frame[6];
+  if (!mpu_owned[get_core_num()] || (SCB_CFSR & CFSR_IACCVIOL) == 0 ||
+      pc < CODE_OVERLAY_BASE || pc >= CODE_OVERLAY_END || cache_lock == nullptr) {
+    return false;
+  }
+
+  const uint32_t core = get_core_num();
+  uint32_t save = spin_lock_blocking(cache_lock);
+  // The fetch that faulted may be the second half of the instruction at pc
+  bool handled = resolve_miss_locked(pc, core);
+  if (handled && pc + 2 < CODE_OVERLAY_END) {
+    resolve_miss_locked(pc + 2, core);
+  }
+  if (handled) {
+    SCB_CFSR = CFSR_IACCVIOL;  // write one to clear
+    record_stall(core, start_us);
+  }
+  spin_unlock(cache_lock, save);
+
+  if (handled) {
+    mpu_sync(core);
+  }
+  return handled;
+}
+
+// Fault entries: pass the exception frame (MSP or PSP) to the C handler,
+// return to retry the instruction, or chain to the HardFault handler
+#define CODE_CACHE_FAULT_ENTRY(name, handler) \
+  extern "C" __attribute__((naked)) void name(void) { \
+    __asm__ volatile(                                \
+        "tst lr, #4\n"                               \
+        "ite eq\n"                                   \
+        "mrseq r0, msp\n"                            \
+        "mrsne r0, psp\n"                            \
+        "push {r4, lr}\n"                            \
+        "bl " #handler "\n"                          \
+        "pop {r4, lr}\n"                             \
+        "cbz r0, 1f\n"                               \
+        "bx lr\n"                                    \
+        "1:\n"                                       \
+        "ldr r1, =code_cache_prev_fault\n"           \
+        "ldr r1, [r1]\n"                             \
+        "bx r1\n");                                  \
+  }
+
+CODE_CACHE_FAULT_ENTRY(code_cache_usage_fault_entry, code_cache_usage_fault)
+CODE_CACHE_FAULT_ENTRY(code_cache_mem_fault_entry, code_cache_mem_fault)
+
+void code_cache_enable_demand_paging(void) {
+  const uint32_t core = get_core_num();
+  if (!fault_handlers_installed) {
+    // The vector table is shared by both cores
+    fault_handlers_installed = true;
+    code_cache_prev_fault = exception_get_vtable_handler(HARDFAULT_EXCEPTION);
+    exception_set_exclusive_handler(USAGEFAULT_EXCEPTION, code_cache_usage_fault_entry);
+    exception_set_exclusive_handler(MEMMANAGE_EXCEPTION, code_cache_mem_fault_entry);
+  }
+  // Without these, UDF and MPU faults escalate straight to HardFault
+  SCB_SHCSR |= SHCSR_USGFAULTENA | SHCSR_MEMFAULTENA;
+
+  // Take the MPU only if nothing else on this core has enabled it and it
+  // has enough regions; otherwise the UDF fill alone catches misses
+  if (!mpu_owned[core]) {
+    const uint32_t regions = (MPU_TYPE >> 8) & 0xFFu;
+    if ((MPU_CTRL & MPU_CTRL_ENABLE) != 0 || regions < MPU_MAX_REGIONS) {
+      return;
+    }
+    MPU_MAIR0 = (MPU_MAIR0 & ~0xFFu) | 0xFFu;  // attr 0: normal, write-back, like the default SRAM map
+    mpu_owned[core] = true;
+  }
+  mpu_sync(core);
+}
+
+bool code_cache_get_stats(uint32_t core, CodeCacheStats* out) {
+  if (core > 1 || out == nullptr || cache_lock == nullptr) {
+    return false;
+  }
+  uint32_t save = spin_lock_blocking(cache_lock);
+  *out = core_stats[core];
+  spin_unlock(cache_lock, save);
+  return true;
+}
+
 #ifdef __cplusplus
 }
 #endif
-
@@ -6,22 +6,69 @@
 extern "C" {
 #endif
 
+// Code pages are loaded at their linked address inside the overlay window,
+// so loading one page never overwrites another. All state is guarded by a
+// hardware spinlock and may be used from both cores.
+//
+// A loaded page stays in the window until the next app load. Eviction, LRU
+// order, pins and the per-core partition manage only the 64 tracking slots
+// and the counters: an evicted page keeps its bytes and stays executable,
+// and its next request copies it again. They never change which code is
+// present.
+//
+// Running into a page that was never loaded faults on that core, and the
+// handler loads the page and retries - so code on either core may call
+// across pages freely. Each core's MPU marks runs of absent pages
+// execute-never (MemManage); the window is also filled with UDF
+// (UsageFault) for runs beyond the MPU's 8 regions. Code that runs with
+// interrupts masked (PRIMASK) must stay on loaded pages: there the fault
+// escalates to HardFault instead.
+
+typedef struct {
+  uint32_t loads;      // pages copied in by this core
+  uint32_t hits;       // requests for a page that was already present
+  uint32_t evictions;  // tracking slots this core reclaimed
+  uint32_t faults;     // page misses taken as faults
+  uint32_t stall_us;   // total time spent in those faults
+  uint32_t max_stall_us;
+} CodeCacheStats;
+
 // Initialize code overlay system
 void code_cache_init(void);
 
-// Load a page into cache
+// Load a page into cache; critical pages are pinned for good
 bool code_cache_load_page(uint32_t page_id, bool critical);
 
+// Load a page and keep its tracking slot until the matching
+// code_cache_unpin() (the page itself is never removed, see above)
+bool code_cache_pin(uint32_t page_id);
+void code_cache_unpin(uint32_t page_id);
+
+// Split the tracking slots between the cores: core 0 gets core0_slots,
+// core 1 the rest, and each core only evicts its own entries. 0 shares all
+// slots. Bookkeeping only; see above.
+bool code_cache_set_partition(uint32_t core0_slots);
+
 // Get cache address for a page (loads if not present)
 uint32_t code_cache_get_addr(uint32_t page_id);
 
 // Find page ID for an address
 uint32_t code_cache_find_page(uint32_t addr);
 
+// End of the app's code pages in the overlay window (its base when there
+// are none); the app heap starts above it
+uint32_t code_cache_code_end(void);
+
 // Preload pages (for optimization)
 void code_cache_preload_pages(const uint32_t* page_ids, uint32_t count);
 
+// Install the page-miss fault handlers (once), enable them on the calling
+// core and take its MPU if unused. code_cache_init() does this for core 0.
+void code_cache_enable_demand_paging(void);
+
+// Per-core counters (core 0 or 1)
+bool code_cache_get_stats(uint32_t core, CodeCacheStats* out);
+
 #ifdef __cplusplus
 }
 #endif
-
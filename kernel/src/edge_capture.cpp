@@ -0,0 +1,160 @@
+#include <Arduino.h>
+#include <stdint.h>
+#include <string.h>
+#include <hardware/gpio.h>
+#include <hardware/irq.h>
+#include <hardware/clocks.h>
+#include <hardware/structs/io_bank0.h>
+#include <hardware/structs/sio.h>
+
+#include "edge_capture.h"
+#include "syscall_validation.h"
+#include "kernel_util.h"
+
+// Cycle counter of the core taking the interrupt (core 0)
+#define DEMCR      (*(volatile uint32_t*)0xE000EDFCu)
+#define DWT_CTRL   (*(volatile uint32_t*)0xE0001000u)
+#define DWT_CYCCNT (*(volatile uint32_t*)0xE0001004u)
+#define DEMCR_TRCENA     (1u << 24)
+#define DWT_CYCCNTENA    (1u << 0)
+
+#define EDGE_CAPTURE_PINS 30u
+#define EDGE_CAPTURE_REGS ((EDGE_CAPTURE_PINS + 7u) / 8u)
+
+static_assert((EDGE_CAPTURE_RING & (EDGE_CAPTURE_RING - 1)) == 0, "EDGE_CAPTURE_RING must be a power of two");
+
+// Single producer (the interrupt) and single consumer (the read syscall,
+// which always runs on core 0 as well)
+static EdgeCaptureRecord g_ring[EDGE_CAPTURE_RING];
+static volatile uint32_t g_head = 0;
+static volatile uint32_t g_tail = 0;
+static volatile uint32_t g_overruns = 0;
+static uint32_t g_pin_mask = 0;
+static uint32_t g_edge_bits[EDGE_CAPTURE_REGS];  // captured pins' edge bits per INTR word
+
+static inline void __not_in_flash_func(pushRecord)(uint32_t& head, uint32_t cycles, uint32_t pin,
+                                                  uint32_t edge) {
+  if (head - g_tail == EDGE_CAPTURE_RING) {
+    g_overruns++;
+    return;
+  }
+  EdgeCaptureRecord& r = g_ring[head & (EDGE_CAPTURE_RING - 1)];
+  r.cycles = cycles;
+  r.pin = static_cast<uint8_t>(pin);
+  r.edge = static_cast<uint8_t>(edge);
+  r.reserved = 0;
+  head++;
+}
+
+// Runs ahead of the SDK's GPIO callback dispatch, which skips pins that a
+// raw handler owns. Each INTR/INTS word holds 4 event bits for 8 pins.
+static void __not_in_flash_func(edgeCaptureIrq)(void) {
+  const uint32_t cycles = DWT_CYCCNT;
+  const uint32_t levels = sio_hw->gpio_in;
+  uint32_t head = g_head;
+  for (uint32_t reg = 0; reg < EDGE_CAPTURE_REGS; ++reg) {
+    if (g_edge_bits[reg] == 0) {
+      continue;
+    }
+    uint32_t events = io_bank0_hw->proc0_irq_ctrl.ints[reg] & g_edge_bits[reg];
+    if (events == 0) {
+      continue;
+    }
+    io_bank0_hw->intr[reg] = events;
+    while (events != 0) {
+      const uint32_t shift = __builtin_ctz(events) & ~3u;
+      const uint32_t pin_events = (events >> shift) & 0xCu;
+      events &= ~(0xFu << shift);
+      const uint32_t pin = reg * 8u + shift / 4u;
+      if (pin_events == (EDGE_CAPTURE_FALL | EDGE_CAPTURE_RISE)) {
+        // Both edges since the last interrupt: the level says which came last
+        const bool high = (levels >> pin) & 1u;
+        pushRecord(head, cycles, pin, high ? EDGE_CAPTURE_FALL : EDGE_CAPTURE_RISE);
+        pushRecord(head, cycles, pin, high ? EDGE_CAPTURE_RISE : EDGE_CAPTURE_FALL);
+      } else {
+        pushRecord(head, cycles, pin, pin_events);
+      }
+    }
+  }
+  __atomic_store_n(&g_head, head, __ATOMIC_RELEASE);
+}
+
+extern "C" bool edge_capture_start(uint32_t pin_mask, uint32_t edges) {
+  if (pin_mask == 0 || (pin_mask >> EDGE_CAPTURE_PINS) != 0 ||
+      edges == 0 || (edges & ~(EDGE_CAPTURE_FALL | EDGE_CAPTURE_RISE)) != 0) {
+    reportError("EdgeCapture_start", "bad pin mask or edges");
+    return false;
+  }
+  // The radio driver has its own raw handler on GPIO24, and GPIO29 is
+  // its SPI clock
+  if ((pin_mask & kRadioPinMask) != 0) {
+    reportError("EdgeCapture_start", "pin is reserved for the CYW43 radio");
+    return false;
+  }
+  edge_capture_stop();
+
+  DEMCR |= DEMCR_TRCENA;
+  DWT_CTRL |= DWT_CYCCNTENA;
+
+  g_head = 0;
+  g_tail = 0;
+  g_overruns = 0;
+  g_pin_mask = pin_mask;
+  for (uint32_t pin = 0; pin < EDGE_CAPTURE_PINS; ++pin) {
+    if (pin_mask & (1u << pin)) {
+      g_edge_bits[pin / 8u] |= (EDGE_CAPTURE_FALL | EDGE_CAPTURE_RISE) << ((pin % 8u) * 4u);
+    }
+  }
+  gpio_add_raw_irq_handler_masked(pin_mask, edgeCaptureIrq);
+  for (uint32_t pin = 0; pin < EDGE_CAPTURE_PINS; ++pin) {
+    if (pin_mask & (1u << pin)) {
+      gpio_set_irq_enabled(pin, edges, true);
+    }
+  }
+  irq_set_enabled(IO_IRQ_BANK0, true);
+  return true;
+}
+
+extern "C" void edge_capture_stop(void) {
+  if (g_pin_mask == 0) {
+    return;
+  }
+  for (uint32_t pin = 0; pin < EDGE_CAPTURE_PINS; ++pin) {
+    if (g_pin_mask & (1u << pin)) {
+      gpio_set_irq_enabled(pin, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, false);
+    }
+  }
+  gpio_remove_raw_irq_handler_masked(g_pin_mask, edgeCaptureIrq);
+  g_pin_mask = 0;
+  memset(g_edge_bits, 0, sizeof(g_edge_bits));
+}
+
+extern "C" uint32_t edge_capture_read(EdgeCaptureRecord* out, uint32_t max_records) {
+  if (max_records > EDGE_CAPTURE_RING) {
+    max_records = EDGE_CAPTURE_RING;
+  }
+  if (max_records == 0 ||
+      !syscall_validation::isValidAppWritable(out, max_records * sizeof(EdgeCaptureRecord))) {
+    return 0;
+  }
+  const uint32_t tail = g_tail;
+  uint32_t count = __atomic_load_n(&g_head, __ATOMIC_ACQUIRE) - tail;
+  if (count > max_records) {
+    count = max_records;
+  }
+  // At most two runs: up to the end of the ring, then from its start
+  const uint32_t start = tail & (EDGE_CAPTURE_RING - 1);
+  const uint32_t first = count < EDGE_CAPTURE_RING - start ? count : EDGE_CAPTURE_RING - start;
+  memcpy(out, &g_ring[start], first * sizeof(EdgeCaptureRecord));
+  memcpy(out + first, &g_ring[0], (count - first) * sizeof(EdgeCaptureRecord));
+  __atomic_store_n(&g_tail, tail + count, __ATOMIC_RELEASE);
+  return count;
+}
+
+extern "C" uint32_t edge_capture_overruns(void) {
+  return g_overruns;
+}
+
+extern "C" uint32_t edge_capture_clock_hz(void) {
+  return clock_get_hz(clk_sys);
+}
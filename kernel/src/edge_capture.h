@@ -0,0 +1,53 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Timestamped GPIO edge capture for fast pulse trains (encoders, RF).
+//
+// Edges on the pins in `pin_mask` are recorded by a raw IO_IRQ_BANK0
+// handler that runs from RAM and never calls app code: it stamps each
+// interrupt with the DWT cycle counter (clk_sys cycles, wrapping every
+// 2^32 cycles) and appends one record per edge to a kernel ring. The app
+// drains any number of records with one edge_capture_read().
+//
+// Edges closer together than the interrupt latency coalesce: a pin that
+// rose and fell before the handler ran yields both records, ordered by the
+// pin's level at that point, with the same timestamp; more than one pair is
+// lost. Captured pins take over from attachInterrupt() on those pins.
+// The CYW43 radio pins (GPIO23, 24, 25, 29) cannot be captured.
+
+#define EDGE_CAPTURE_RING 1024  // records, power of two
+
+// Edge values, as GPIO_IRQ_EDGE_FALL / _RISE
+#define EDGE_CAPTURE_FALL 0x4u
+#define EDGE_CAPTURE_RISE 0x8u
+
+typedef struct {
+  uint32_t cycles;  // DWT CYCCNT when the interrupt was taken
+  uint8_t pin;
+  uint8_t edge;     // EDGE_CAPTURE_FALL or EDGE_CAPTURE_RISE
+  uint16_t reserved;
+} EdgeCaptureRecord;
+
+// `edges` is EDGE_CAPTURE_RISE and/or EDGE_CAPTURE_FALL. Restarts the
+// capture (and empties the ring) if it is already running.
+bool edge_capture_start(uint32_t pin_mask, uint32_t edges);
+void edge_capture_stop(void);
+
+// Copy up to `max_records` of the oldest records to `out`; returns the count
+uint32_t edge_capture_read(EdgeCaptureRecord* out, uint32_t max_records);
+
+// Records dropped because the ring was full
+uint32_t edge_capture_overruns(void);
+
+// clk_sys frequency, to turn cycle differences into time
+uint32_t edge_capture_clock_hz(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,149 @@
+/* ===========================================================================
+ *  AUTO-GENERATED FILE - DO NOT EDIT unless you know what you're doing!!
+ *  ---------------------------------------------------------------------------
+ *  Generated by : syscall_gen.py                
+ *  Timestamp    : 2026-10-18 20:26:25 Local
+ *  File         : kernel_sys_dispatch.inc.h
+ *  Source Hash:  556a0cda55662869                                            
+ *  This file is produced automatically during the build process.
+ *  Manual edits will be overwritten on the next regeneration.
+ * ===========================================================================
+ */
+using HSPI = std::remove_reference_t<decltype(SPI)>;
+using HSerial = std::remove_reference_t<decltype(Serial)>;
+using HWiFi = std::remove_reference_t<decltype(WiFi)>;
+using HWire = std::remove_reference_t<decltype(Wire)>;
+
+  case SYSC_pinMode: return detail::invoke<&::pinMode>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_digitalWrite: return detail::invoke<&::digitalWrite>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_digitalRead: return detail::invoke<&::digitalRead>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_gpio_claim: return detail::invoke<&syscall_safe_wrappers::gpioClaim>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_gpio_release: return detail::invoke<&syscall_safe_wrappers::gpioRelease>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_gpio_claimed: return detail::invoke<&syscall_safe_wrappers::gpioClaimed>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_gpio_put_masked: return detail::invoke<&syscall_safe_wrappers::gpioPutMasked>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_gpio_set_dir_masked: return detail::invoke<&syscall_safe_wrappers::gpioSetDirMasked>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_gpio_get_all: return detail::invoke<&syscall_safe_wrappers::gpioGetAll>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_delay: return detail::invoke<&::delay>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_delayMicroseconds: return detail::invoke<&::delayMicroseconds>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_millis: return detail::invoke<&::millis>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_micros: return detail::invoke<&::micros>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Timer_startRepeating: return detail::invoke<&::app_timer_start_repeating>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Timer_startOnce: return detail::invoke<&::app_timer_start_once>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Timer_stop: return detail::invoke<&::app_timer_stop>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Timer_getStats: return detail::invoke<&::app_timer_get_stats>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_App_setLoopMode: return detail::invoke<&::app_scheduler_set_mode>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_App_loopWake: return detail::invoke<&::app_scheduler_wake>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_App_getLoopStats: return detail::invoke<&::app_scheduler_get_stats>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_App_resetLoopStats: return detail::invoke<&::app_scheduler_reset_stats>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Task_create: return detail::invoke<&::app_task_create>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Task_delete: return detail::invoke<&::app_task_delete>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Task_notifyGive: return detail::invoke<&::app_task_notify_give>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Task_notifyTake: return detail::invoke<&::app_task_notify_take>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Queue_create: return detail::invoke<&::app_queue_create>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Queue_delete: return detail::invoke<&::app_queue_delete>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Queue_send: return detail::invoke<&::app_queue_send>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Queue_receive: return detail::invoke<&::app_queue_receive>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Queue_count: return detail::invoke<&::app_queue_count>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Event_create: return detail::invoke<&::app_event_create>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Event_delete: return detail::invoke<&::app_event_delete>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Event_set: return detail::invoke<&::app_event_set>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Event_clear: return detail::invoke<&::app_event_clear>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Event_wait: return detail::invoke<&::app_event_wait>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Cache_pin: return detail::invoke<&syscall_safe_wrappers::cachePin>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Cache_unpin: return detail::invoke<&syscall_safe_wrappers::cacheUnpin>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Cache_setPartition: return detail::invoke<&syscall_safe_wrappers::cacheSetPartition>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Cache_getStats: return detail::invoke<&syscall_safe_wrappers::cacheGetStats>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_analogRead: return detail::invoke<&::analogRead>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_analogWrite: return detail::invoke<&::analogWrite>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_ADC_startStream: return detail::invoke<&::adc_stream_start>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_ADC_stopStream: return detail::invoke<&::adc_stream_stop>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_ADC_streamPoll: return detail::invoke<&::adc_stream_poll>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_ADC_streamOverruns: return detail::invoke<&::adc_stream_overruns>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_EdgeCapture_start: return detail::invoke<&::edge_capture_start>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_EdgeCapture_stop: return detail::invoke<&::edge_capture_stop>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_EdgeCapture_read: return detail::invoke<&::edge_capture_read>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_EdgeCapture_overruns: return detail::invoke<&::edge_capture_overruns>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_EdgeCapture_clockHz: return detail::invoke<&::edge_capture_clock_hz>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Pio_load: return detail::invoke<&::app_pio_load>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Pio_unload: return detail::invoke<&::app_pio_unload>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Pio_smInit: return detail::invoke<&::app_pio_sm_init>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Pio_smRelease: return detail::invoke<&::app_pio_sm_release>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Pio_smEnable: return detail::invoke<&::app_pio_sm_enable>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Pio_smExec: return detail::invoke<&::app_pio_sm_exec>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Pio_put: return detail::invoke<&::app_pio_put>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Pio_get: return detail::invoke<&::app_pio_get>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Pio_dmaPut: return detail::invoke<&::app_pio_dma_put>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Pio_dmaGet: return detail::invoke<&::app_pio_dma_get>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Pio_dmaBusy: return detail::invoke<&::app_pio_dma_busy>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_begin: return detail::invoke_method<&Serial, static_cast<void (HSerial::*)(unsigned long)>(&HSerial::begin)>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_write_b: return detail::invoke_method<&Serial, static_cast<size_t (arduino::Print::*)(uint8_t)>(&arduino::Print::write)>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_available: return detail::invoke_method<&Serial, static_cast<int (HSerial::*)()>(&HSerial::available)>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_read: return detail::invoke_method<&Serial, static_cast<int (HSerial::*)()>(&HSerial::read)>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_peek: return detail::invoke_method<&Serial, static_cast<int (HSerial::*)()>(&HSerial::peek)>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_flush: return detail::invoke_method<&Serial, static_cast<void (HSerial::*)()>(&HSerial::flush)>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_print_s: return detail::invoke<&syscall_safe_wrappers::serialPrintSafe>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_println_s: return detail::invoke<&syscall_safe_wrappers::serialPrintlnSafe>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_println: return detail::invoke_method<&Serial, static_cast<size_t (arduino::Print::*)()>(&arduino::Print::println)>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_writeBuf: return detail::invoke<&syscall_safe_wrappers::serialWriteBufSafe>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_readBuf: return detail::invoke<&syscall_safe_wrappers::serialReadBuf>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Serial_readUntil: return detail::invoke<&syscall_safe_wrappers::serialReadUntil>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_SPI_begin: return detail::invoke_method<&SPI, static_cast<void (HSPI::*)()>(&HSPI::begin)>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_SPI_end: return detail::invoke_method<&SPI, static_cast<void (HSPI::*)()>(&HSPI::end)>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_SPI_beginTransaction: return detail::invoke<&syscall_safe_wrappers::spiBeginTransaction>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_SPI_endTransaction: return detail::invoke<&syscall_safe_wrappers::spiEndTransaction>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_SPI_transfer: return detail::invoke<&syscall_safe_wrappers::spiTransfer>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_SPI_transferBuf: return detail::invoke<&syscall_safe_wrappers::spiTransferBuf>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_SPI_writeBuf: return detail::invoke<&syscall_safe_wrappers::spiWriteBuf>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_SPI_transferAsync: return detail::invoke<&syscall_safe_wrappers::spiTransferAsync>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_SPI_asyncDone: return detail::invoke<&syscall_safe_wrappers::spiAsyncDone>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_begin: return detail::invoke<&syscall_safe_wrappers::wireBegin>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_end: return detail::invoke<&syscall_safe_wrappers::wireEnd>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_beginTransmission: return detail::invoke<&syscall_safe_wrappers::wireBeginTransmission>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_endTransmission: return detail::invoke<&syscall_safe_wrappers::wireEndTransmission>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_requestFrom: return detail::invoke<&syscall_safe_wrappers::wireRequestFrom>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_write_b: return detail::invoke<&syscall_safe_wrappers::wireWriteByte>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_write_buf: return detail::invoke<&syscall_safe_wrappers::wireWriteBuf>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_available: return detail::invoke<&syscall_safe_wrappers::wireAvailable>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_read: return detail::invoke<&syscall_safe_wrappers::wireRead>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_readBuf: return detail::invoke<&syscall_safe_wrappers::wireReadBuf>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_writeReg: return detail::invoke<&syscall_safe_wrappers::wireWriteReg>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_readBufAsync: return detail::invoke<&syscall_safe_wrappers::wireReadBufAsync>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Wire_writeRegAsync: return detail::invoke<&syscall_safe_wrappers::wireWriteRegAsync>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_multicore_reset_core1: return detail::invoke<&multicore_reset_core1>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_multicore_launch_core1: return detail::invoke<&syscall_safe_wrappers::multicoreLaunchCore1Safe>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_multicore_fifo_push_blocking: return detail::invoke<&multicore_fifo_push_blocking>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_multicore_fifo_pop_blocking: return detail::invoke<&multicore_fifo_pop_blocking>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_multicore_fifo_rvalid: return detail::invoke<&multicore_fifo_rvalid>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_multicore_fifo_wready: return detail::invoke<&multicore_fifo_wready>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_bootselButton: return detail::invoke<&::bootselButton>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_softwareReset: return detail::invoke<&::softwareReset>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_attachInterrupt: return detail::invoke<&::KernelAttachInterrupt>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_detachInterrupt: return detail::invoke<&::KernelDetachInterrupt>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_attachInterruptDeferred: return detail::invoke<&::KernelAttachInterruptDeferred>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Defer_post: return detail::invoke<&::app_defer_post>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Defer_getStats: return detail::invoke<&::app_defer_get_stats>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_Defer_resetStats: return detail::invoke<&::app_defer_reset_stats>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_begin: return detail::invoke<&syscall_safe_wrappers::wifiBegin>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_begin_open: return detail::invoke<&syscall_safe_wrappers::wifiBeginOpen>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_status: return detail::invoke<&syscall_safe_wrappers::wifiStatus>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_disconnect: return detail::invoke<&syscall_safe_wrappers::wifiDisconnect>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_localIP: return detail::invoke<&syscall_safe_wrappers::wifiLocalIP>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_subnetMask: return detail::invoke<&syscall_safe_wrappers::wifiSubnetMask>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_gatewayIP: return detail::invoke<&syscall_safe_wrappers::wifiGatewayIP>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_SSID: return detail::invoke<&syscall_safe_wrappers::wifiSSID>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_RSSI: return detail::invoke_method<&WiFi, static_cast<int32_t (HWiFi::*)()>(&HWiFi::RSSI)>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_macAddress: return detail::invoke<&syscall_safe_wrappers::wifiMacAddress>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_hostname: return detail::invoke<&syscall_safe_wrappers::wifiHostname>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_WiFi_getHostname: return detail::invoke<&syscall_safe_wrappers::wifiGetHostname>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_begin: return detail::invoke<&BLE_begin>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_end: return detail::invoke<&BLE_end>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_advertise: return detail::invoke<&BLE_advertise>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_stopAdvertise: return detail::invoke<&BLE_stopAdvertise>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_setAdvertisedServiceData: return detail::invoke<&syscall_safe_wrappers::bleSetAdvertisedServiceData>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_setAdvertisedServiceUuid: return detail::invoke<&syscall_safe_wrappers::bleSetAdvertisedServiceUuid>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_setLocalName: return detail::invoke<&syscall_safe_wrappers::bleSetLocalName>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_available: return detail::invoke<&BLE_available>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_central: return detail::invoke<&BLE_central>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_connected: return detail::invoke<&BLE_connected>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_disconnect: return detail::invoke<&BLE_disconnect>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
+  case SYSC_BLE_address: return detail::invoke<&syscall_safe_wrappers::bleAddress>(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29);
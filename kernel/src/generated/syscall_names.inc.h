@@ -0,0 +1,144 @@
+/* ===========================================================================
+ *  AUTO-GENERATED FILE - DO NOT EDIT unless you know what you're doing!!
+ *  ---------------------------------------------------------------------------
+ *  Generated by : syscall_gen.py                
+ *  Timestamp    : 2026-10-18 20:26:25 Local
+ *  File         : syscall_names.inc.h
+ *  Source Hash:  556a0cda55662869                                            
+ *  This file is produced automatically during the build process.
+ *  Manual edits will be overwritten on the next regeneration.
+ * ===========================================================================
+ */
+  "pinMode",
+  "digitalWrite",
+  "digitalRead",
+  "gpio_claim",
+  "gpio_release",
+  "gpio_claimed",
+  "gpio_put_masked",
+  "gpio_set_dir_masked",
+  "gpio_get_all",
+  "delay",
+  "delayMicroseconds",
+  "millis",
+  "micros",
+  "Timer_startRepeating",
+  "Timer_startOnce",
+  "Timer_stop",
+  "Timer_getStats",
+  "App_setLoopMode",
+  "App_loopWake",
+  "App_getLoopStats",
+  "App_resetLoopStats",
+  "Task_create",
+  "Task_delete",
+  "Task_notifyGive",
+  "Task_notifyTake",
+  "Queue_create",
+  "Queue_delete",
+  "Queue_send",
+  "Queue_receive",
+  "Queue_count",
+  "Event_create",
+  "Event_delete",
+  "Event_set",
+  "Event_clear",
+  "Event_wait",
+  "Cache_pin",
+  "Cache_unpin",
+  "Cache_setPartition",
+  "Cache_getStats",
+  "analogRead",
+  "analogWrite",
+  "ADC_startStream",
+  "ADC_stopStream",
+  "ADC_streamPoll",
+  "ADC_streamOverruns",
+  "EdgeCapture_start",
+  "EdgeCapture_stop",
+  "EdgeCapture_read",
+  "EdgeCapture_overruns",
+  "EdgeCapture_clockHz",
+  "Pio_load",
+  "Pio_unload",
+  "Pio_smInit",
+  "Pio_smRelease",
+  "Pio_smEnable",
+  "Pio_smExec",
+  "Pio_put",
+  "Pio_get",
+  "Pio_dmaPut",
+  "Pio_dmaGet",
+  "Pio_dmaBusy",
+  "Serial_begin",
+  "Serial_write_b",
+  "Serial_available",
+  "Serial_read",
+  "Serial_peek",
+  "Serial_flush",
+  "Serial_print_s",
+  "Serial_println_s",
+  "Serial_println",
+  "Serial_writeBuf",
+  "Serial_readBuf",
+  "Serial_readUntil",
+  "SPI_begin",
+  "SPI_end",
+  "SPI_beginTransaction",
+  "SPI_endTransaction",
+  "SPI_transfer",
+  "SPI_transferBuf",
+  "SPI_writeBuf",
+  "SPI_transferAsync",
+  "SPI_asyncDone",
+  "Wire_begin",
+  "Wire_end",
+  "Wire_beginTransmission",
+  "Wire_endTransmission",
+  "Wire_requestFrom",
+  "Wire_write_b",
+  "Wire_write_buf",
+  "Wire_available",
+  "Wire_read",
+  "Wire_readBuf",
+  "Wire_writeReg",
+  "Wire_readBufAsync",
+  "Wire_writeRegAsync",
+  "multicore_reset_core1",
+  "multicore_launch_core1",
+  "multicore_fifo_push_blocking",
+  "multicore_fifo_pop_blocking",
+  "multicore_fifo_rvalid",
+  "multicore_fifo_wready",
+  "bootselButton",
+  "softwareReset",
+  "attachInterrupt",
+  "detachInterrupt",
+  "attachInterruptDeferred",
+  "Defer_post",
+  "Defer_getStats",
+  "Defer_resetStats",
+  "WiFi_begin",
+  "WiFi_begin_open",
+  "WiFi_status",
+  "WiFi_disconnect",
+  "WiFi_localIP",
+  "WiFi_subnetMask",
+  "WiFi_gatewayIP",
+  "WiFi_SSID",
+  "WiFi_RSSI",
+  "WiFi_macAddress",
+  "WiFi_hostname",
+  "WiFi_getHostname",
+  "BLE_begin",
+  "BLE_end",
+  "BLE_advertise",
+  "BLE_stopAdvertise",
+  "BLE_setAdvertisedServiceData",
+  "BLE_setAdvertisedServiceUuid",
+  "BLE_setLocalName",
+  "BLE_available",
+  "BLE_central",
+  "BLE_connected",
+  "BLE_disconnect",
+  "BLE_address",
@@ -15,6 +15,8 @@
 #include <hardware/structs/sio.h>
 #include <FreeRTOS.h>
 #include <task.h>
+#include <queue.h>
+#include <semphr.h>
 
 // Stub out Ethernet async-context functions that lwIP_Ethernet expects
 // These are required by lwIP_Ethernet but not available in FreeRTOS builds
@@ -49,7 +51,15 @@ extern "C" {
 #include "generated/syscall_ids.h"
 #include "syscall_invoke.h"
 #include "syscall_validation.h"
+#include "kernel_util.h"
 #include "code_cache.h"
+#include "adc_stream.h"
+#include "app_timer.h"
+#include "app_scheduler.h"
+#include "app_tasks.h"
+#include "app_defer.h"
+#include "edge_capture.h"
+#include "app_pio.h"
 
 //#define DEBUG_SYSCALLS
 
@@ -67,9 +77,11 @@ struct Core1SyscallMessage {
   volatile uintptr_t args[30];
   volatile uintptr_t result;
   volatile uint32_t done;
+  volatile uintptr_t caller_sp;  // core 1 SP, for stack buffer checks
 };
 
 static volatile Core1SyscallMessage g_core1_sys_msg = {};
+static volatile uintptr_t g_core1_stack_top = 0;
 static constexpr uint32_t kCore1SyscallReqMagic = 0xC0DEF1F0;
 static constexpr uintptr_t kCore1StatusAddr = 0x2002F000u;
 static constexpr bool kCore1StatusEnabled = false;
@@ -109,9 +121,548 @@ static size_t serialPrintlnSafe(const char* s) {
   return Serial.println(s);
 }
 
-// SPI wrapper - beginTransaction with default settings
-static void spiBeginTransaction() {
-  SPI.beginTransaction(SPISettings());  // Default settings
+static size_t serialWriteBufSafe(const uint8_t* buf, size_t len) {
+  if (len == 0) {
+    return 0;
+  }
+  if (!syscall_validation::isValidAppPointer(buf, len)) {
+    Serial.println("[Kernel] ERROR: Invalid buffer pointer in Serial.write");
+    return 0;
+  }
+  return Serial.write(buf, len);
+}
+
+// Bulk receive. Bytes already buffered by the USB stack are copied in one
+// go; while waiting for more the calling task sleeps instead of spinning.
+// `delim` < 0 reads until `len` bytes or the timeout; otherwise reading
+// also stops at `delim`, which is consumed but not stored (like
+// Stream::readBytesUntil). Returns the number of bytes stored.
+static size_t serialReadInto(uint8_t* buf, size_t len, int delim, uint32_t timeout_ms,
+                             const char* what) {
+  if (len == 0) {
+    return 0;
+  }
+  if (!syscall_validation::isValidAppWritable(buf, len)) {
+    Serial.print("[Kernel] ERROR: Invalid buffer pointer in ");
+    Serial.println(what);
+    return 0;
+  }
+  size_t count = 0;
+  const uint32_t start = millis();
+  while (count < len) {
+    int avail = Serial.available();
+    if (avail <= 0) {
+      if (millis() - start >= timeout_ms) {
+        break;
+      }
+      vTaskDelay(1);
+      continue;
+    }
+    while (avail-- > 0 && count < len) {
+      int c = Serial.read();
+      if (c < 0) {
+        break;
+      }
+      if (c == delim) {
+        return count;
+      }
+      buf[count++] = static_cast<uint8_t>(c);
+    }
+  }
+  return count;
+}
+
+static size_t serialReadBuf(uint8_t* buf, size_t len, uint32_t timeout_ms) {
+  return serialReadInto(buf, len, -1, timeout_ms, "Serial.readBytes");
+}
+
+static size_t serialReadUntil(uint8_t* buf, size_t len, uint8_t delim, uint32_t timeout_ms) {
+  return serialReadInto(buf, len, delim, timeout_ms, "Serial.readBytesUntil");
+}
+
+}  // namespace syscall_safe_wrappers
+
+// =====================================================================
+// SPI support wrappers
+// =====================================================================
+// Bulk transfers move a whole app buffer per syscall. Large ones run on
+// DMA via SPI.transferAsync(); the calling task yields while it waits.
+// Only one DMA transfer can be in flight, so every other SPI call first
+// waits for a pending async transfer to finish.
+
+namespace syscall_safe_wrappers {
+// Below this size, programming the DMA channels costs more than polling
+static constexpr size_t kSpiDmaMinLength = 32;
+
+static volatile bool g_spi_async_active = false;
+static uint32_t g_spi_async_handle = 0;
+
+// `async` buffers are used by DMA after the call returns, so they must
+// not be on a stack
+static bool spiBuffersValid(const uint8_t* tx, const uint8_t* rx, size_t len, const char* what,
+                            bool async = false) {
+  if ((tx == nullptr && rx == nullptr) ||
+      (tx != nullptr && !(async ? syscall_validation::isValidAppBuffer(tx, len)
+                                : syscall_validation::isValidAppPointer(tx, len))) ||
+      (rx != nullptr && !(async ? syscall_validation::isValidAppBuffer(rx, len)
+                                : syscall_validation::isValidAppWritable(rx, len)))) {
+    Serial.print("[Kernel] ERROR: Invalid buffer pointer in ");
+    Serial.println(what);
+    return false;
+  }
+  return true;
+}
+
+static void spiFinishAsync() {
+  while (g_spi_async_active && !SPI.finishedAsync()) {
+    taskYIELD();
+  }
+  g_spi_async_active = false;
+}
+
+// beginTransaction with the app's SPISettings fields
+static void spiBeginTransaction(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) {
+  spiFinishAsync();
+  SPI.beginTransaction(SPISettings(clock, bitOrder == LSBFIRST ? LSBFIRST : MSBFIRST,
+                                   static_cast<SPIMode>(dataMode & 0x3)));
+}
+
+static void spiEndTransaction() {
+  spiFinishAsync();
+  SPI.endTransaction();
+}
+
+static uint8_t spiTransfer(uint8_t data) {
+  spiFinishAsync();
+  return SPI.transfer(data);
+}
+
+static void spiTransferBuf(const uint8_t* tx, uint8_t* rx, size_t len) {
+  if (len == 0 || !spiBuffersValid(tx, rx, len, "SPI.transfer")) {
+    return;
+  }
+  spiFinishAsync();
+  if (len >= kSpiDmaMinLength && SPI.transferAsync(tx, rx, len)) {
+    g_spi_async_active = true;
+    spiFinishAsync();
+    return;
+  }
+  SPI.transfer(tx, rx, len);
+}
+
+static void spiWriteBuf(const uint8_t* data, size_t len) {
+  spiTransferBuf(data, nullptr, len);
+}
+
+// Starts a DMA transfer and returns at once. Handles only grow, so any
+// handle older than the current one refers to a transfer that has ended.
+static uint32_t spiTransferAsync(const uint8_t* tx, uint8_t* rx, size_t len) {
+  if (len == 0 || !spiBuffersValid(tx, rx, len, "SPI.transferAsync", true)) {
+    return 0;
+  }
+  spiFinishAsync();
+  if (!SPI.transferAsync(tx, rx, len)) {
+    return 0;
+  }
+  g_spi_async_active = true;
+  if (++g_spi_async_handle == 0) {
+    g_spi_async_handle = 1;
+  }
+  return g_spi_async_handle;
+}
+
+static bool spiAsyncDone(uint32_t handle) {
+  if (!g_spi_async_active || handle != g_spi_async_handle) {
+    return true;
+  }
+  // finishedAsync() also releases the DMA channels once the transfer ends
+  if (!SPI.finishedAsync()) {
+    return false;
+  }
+  g_spi_async_active = false;
+  return true;
+}
+}  // namespace syscall_safe_wrappers
+
+// =====================================================================
+// Wire (I2C) support wrappers
+// =====================================================================
+// Wire_readBuf/Wire_writeReg run a whole register transaction (address,
+// register, data, repeated start) per syscall. The *Async variants queue
+// the same transaction for a kernel worker task and report completion by
+// storing the result into an app-owned int32_t status word, which reads
+// kWirePending until the transfer is over.
+//
+// Results: >= 0 bytes transferred, or one of the negative codes below.
+// The app mirrors them as WIRE_PENDING/WIRE_ERR_* in arduino_proxies.h.
+
+namespace syscall_safe_wrappers {
+static constexpr int32_t kWirePending = -1;
+static constexpr int32_t kWireErrAddressNack = -2;
+static constexpr int32_t kWireErrDataNack = -3;
+static constexpr int32_t kWireErrOther = -4;  // too long, timeout, bus error
+static constexpr int32_t kWireErrShortRead = -5;  // the device sent fewer bytes than asked
+
+static constexpr UBaseType_t kWireQueueDepth = 16;
+
+struct WireJob {
+  uint8_t address;
+  uint8_t reg;
+  bool write;
+  uint8_t* buf;
+  size_t len;
+  volatile int32_t* status;
+};
+
+// Created by Wire_begin; the mutex serializes whole transactions between
+// the worker and synchronous callers
+static SemaphoreHandle_t g_wire_mutex = nullptr;
+static QueueHandle_t g_wire_queue = nullptr;
+
+static int32_t wireErrorStatus(uint8_t code) {
+  if (code == 2) return kWireErrAddressNack;
+  if (code == 3) return kWireErrDataNack;
+  return kWireErrOther;
+}
+
+static int32_t wireReadRegLocked(uint8_t address, uint8_t reg, uint8_t* buf, size_t len) {
+  Wire.beginTransmission(address);
+  Wire.write(reg);
+  uint8_t err = Wire.endTransmission(false);  // repeated start
+  if (err != 0) {
+    return wireErrorStatus(err);
+  }
+  // The address was acked by the write above, so missing bytes are a
+  // short read rather than a NACK; whatever did arrive is still stored
+  size_t got = Wire.requestFrom(address, len, true);
+  for (size_t i = 0; i < got; ++i) {
+    buf[i] = static_cast<uint8_t>(Wire.read());
+  }
+  return (got == len) ? static_cast<int32_t>(got) : kWireErrShortRead;
+}
+
+static int32_t wireWriteRegLocked(uint8_t address, uint8_t reg, const uint8_t* data, size_t len) {
+  Wire.beginTransmission(address);
+  Wire.write(reg);
+  size_t queued = (len > 0) ? Wire.write(data, len) : 0;
+  uint8_t err = Wire.endTransmission(true);
+  if (err != 0) {
+    return wireErrorStatus(err);
+  }
+  // Wire's transmit buffer is finite; a truncated write is not a success
+  return (queued == len) ? static_cast<int32_t>(len) : kWireErrOther;
+}
+
+static void WireAsyncTask(void* /*pv_parameters*/) {
+  WireJob job;
+  for (;;) {
+    if (xQueueReceive(g_wire_queue, &job, portMAX_DELAY) != pdTRUE) {
+      continue;
+    }
+    xSemaphoreTake(g_wire_mutex, portMAX_DELAY);
+    int32_t result = job.write ? wireWriteRegLocked(job.address, job.reg, job.buf, job.len)
+                               : wireReadRegLocked(job.address, job.reg, job.buf, job.len);
+    xSemaphoreGive(g_wire_mutex);
+
+    // Data must be visible before the app sees the status change
+    __dmb();
+    *job.status = result;
+  }
+}
+
+// Byte-wise Wire calls are spread over several syscalls, but the bus is
+// only taken inside one: beginTransmission/write stage the bytes in the
+// calling task's context and endTransmission sends them; requestFrom reads
+// everything into the context, which available/read then drain. The mutex
+// is never held between syscalls, so a task that stops halfway (e.g. after
+// a short requestFrom) cannot block anyone else.
+static constexpr size_t kWireStageSize = 128;
+static constexpr int kWireContexts = 4;
+
+struct WireContext {
+  TaskHandle_t task;  // nullptr: free
+  bool transmitting;  // between beginTransmission and endTransmission
+  bool overflow;      // more bytes written than fit
+  uint8_t address;
+  size_t len;         // bytes staged, or bytes received
+  size_t pos;         // next received byte to read
+  uint8_t buf[kWireStageSize];
+};
+
+// Guarded by taskENTER_CRITICAL; only staging and copies happen inside
+static WireContext g_wire_ctx[kWireContexts];
+
+// The calling task's context (critical section held). With `claim`, a task
+// without one takes a free context, or else one of another task that is not
+// transmitting - that task loses any received bytes it has not read yet.
+static WireContext* wireContext(bool claim) {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  WireContext* spare = nullptr;
+  for (int i = 0; i < kWireContexts; ++i) {
+    WireContext* ctx = &g_wire_ctx[i];
+    if (ctx->task == self) {
+      return ctx;
+    }
+    if (ctx->task == nullptr) {
+      spare = ctx;
+    } else if (spare == nullptr && !ctx->transmitting) {
+      spare = ctx;
+    }
+  }
+  if (!claim || spare == nullptr) {
+    return nullptr;
+  }
+  spare->task = self;
+  spare->transmitting = false;
+  spare->len = 0;
+  spare->pos = 0;
+  return spare;
+}
+
+static void wireLock() {
+  if (g_wire_mutex != nullptr) {
+    xSemaphoreTake(g_wire_mutex, portMAX_DELAY);
+  }
+}
+
+static void wireUnlock() {
+  if (g_wire_mutex != nullptr) {
+    xSemaphoreGive(g_wire_mutex);
+  }
+}
+
+static void wireBegin() {
+  if (g_wire_mutex == nullptr) {
+    g_wire_mutex = xSemaphoreCreateMutex();
+    g_wire_queue = xQueueCreate(kWireQueueDepth, sizeof(WireJob));
+    xTaskCreate(WireAsyncTask, "WireAsync", 1024, nullptr, tskIDLE_PRIORITY + 2, nullptr);
+  }
+  Wire.begin();
+}
+
+static void wireEnd() {
+  wireLock();
+  Wire.end();
+  wireUnlock();
+}
+
+static void wireBeginTransmission(uint8_t address) {
+  taskENTER_CRITICAL();
+  WireContext* ctx = wireContext(true);
+  if (ctx != nullptr) {
+    ctx->transmitting = true;
+    ctx->overflow = false;
+    ctx->address = address;
+    ctx->len = 0;
+    ctx->pos = 0;
+  }
+  taskEXIT_CRITICAL();
+  if (ctx == nullptr) {
+    reportError("Wire.beginTransmission", "too many tasks in a Wire transaction");
+  }
+}
+
+static size_t wireStage(const uint8_t* data, size_t len) {
+  size_t queued = 0;
+  taskENTER_CRITICAL();
+  WireContext* ctx = wireContext(false);
+  if (ctx != nullptr && ctx->transmitting) {
+    queued = kWireStageSize - ctx->len;
+    if (queued > len) {
+      queued = len;
+    }
+    memcpy(ctx->buf + ctx->len, data, queued);
+    ctx->len += queued;
+    ctx->overflow = ctx->overflow || queued != len;
+  }
+  taskEXIT_CRITICAL();
+  return queued;
+}
+
+static size_t wireWriteByte(uint8_t data) {
+  return wireStage(&data, 1);
+}
+
+static size_t wireWriteBuf(const uint8_t* data, size_t len) {
+  if (len == 0) {
+    return 0;
+  }
+  if (!syscall_validation::isValidAppPointer(data, len)) {
+    reportError("Wire.write", "invalid buffer");
+    return 0;
+  }
+  return wireStage(data, len);
+}
+
+// Same codes as Wire.endTransmission(): 0 ok, 1 data too long, 2 address
+// NACK, 3 data NACK, 4 other (including no beginTransmission)
+static uint8_t wireEndTransmission() {
+  uint8_t data[kWireStageSize];
+  size_t len = 0;
+  uint8_t address = 0;
+  bool staged = false;
+  bool overflow = false;
+  taskENTER_CRITICAL();
+  WireContext* ctx = wireContext(false);
+  if (ctx != nullptr && ctx->transmitting) {
+    staged = true;
+    overflow = ctx->overflow;
+    address = ctx->address;
+    len = ctx->len;
+    memcpy(data, ctx->buf, len);
+    ctx->task = nullptr;
+    ctx->transmitting = false;
+  }
+  taskEXIT_CRITICAL();
+  if (!staged) {
+    return 4;
+  }
+  if (overflow) {
+    return 1;
+  }
+  wireLock();
+  Wire.beginTransmission(address);
+  if (len > 0) {
+    Wire.write(data, len);
+  }
+  uint8_t err = Wire.endTransmission();
+  wireUnlock();
+  return err;
+}
+
+static size_t wireRequestFrom(uint8_t address, size_t quantity) {
+  uint8_t data[kWireStageSize];
+  if (quantity > kWireStageSize) {
+    quantity = kWireStageSize;
+  }
+  wireLock();
+  size_t got = Wire.requestFrom(address, quantity);
+  for (size_t i = 0; i < got; ++i) {
+    data[i] = static_cast<uint8_t>(Wire.read());
+  }
+  wireUnlock();
+
+  taskENTER_CRITICAL();
+  WireContext* ctx = got > 0 ? wireContext(true) : wireContext(false);
+  if (ctx != nullptr) {
+    // A new read replaces unread bytes and any transmission in progress
+    ctx->transmitting = false;
+    ctx->len = got;
+    ctx->pos = 0;
+    memcpy(ctx->buf, data, got);
+    if (got == 0) {
+      ctx->task = nullptr;
+    }
+  }
+  taskEXIT_CRITICAL();
+  if (got > 0 && ctx == nullptr) {
+    reportError("Wire.requestFrom", "too many tasks in a Wire transaction");
+    return 0;
+  }
+  return got;
+}
+
+static int wireAvailable() {
+  taskENTER_CRITICAL();
+  WireContext* ctx = wireContext(false);
+  const int n = (ctx != nullptr && !ctx->transmitting) ? static_cast<int>(ctx->len - ctx->pos) : 0;
+  taskEXIT_CRITICAL();
+  return n;
+}
+
+static int wireRead() {
+  int value = -1;
+  taskENTER_CRITICAL();
+  WireContext* ctx = wireContext(false);
+  if (ctx != nullptr && !ctx->transmitting && ctx->pos < ctx->len) {
+    value = ctx->buf[ctx->pos++];
+    if (ctx->pos == ctx->len) {
+      ctx->task = nullptr;  // drained: free it for other tasks
+    }
+  }
+  taskEXIT_CRITICAL();
+  return value;
+}
+
+// Queued jobs use `buf` after the call returns, so it must not be on a
+// stack; synchronous reads need it writable
+enum class WireBuf { kRead, kWrite, kQueued };
+
+static bool wireBufferValid(const uint8_t* buf, size_t len, const char* what, WireBuf use) {
+  bool valid = true;
+  if (len > 0) {
+    switch (use) {
+      case WireBuf::kRead: valid = syscall_validation::isValidAppPointer(buf, len); break;
+      case WireBuf::kWrite: valid = syscall_validation::isValidAppWritable(buf, len); break;
+      case WireBuf::kQueued: valid = syscall_validation::isValidAppBuffer(buf, len); break;
+    }
+  }
+  if (!valid) {
+    Serial.print("[Kernel] ERROR: Invalid buffer pointer in ");
+    Serial.println(what);
+    return false;
+  }
+  if (g_wire_mutex == nullptr) {
+    Serial.print("[Kernel] ERROR: Wire.begin() not called before ");
+    Serial.println(what);
+    return false;
+  }
+  return true;
+}
+
+static int32_t wireReadBuf(uint8_t address, uint8_t reg, uint8_t* buf, size_t len) {
+  if (len == 0 || !wireBufferValid(buf, len, "Wire.readBuf", WireBuf::kWrite)) {
+    return kWireErrOther;
+  }
+  xSemaphoreTake(g_wire_mutex, portMAX_DELAY);
+  int32_t result = wireReadRegLocked(address, reg, buf, len);
+  xSemaphoreGive(g_wire_mutex);
+  return result;
+}
+
+static int32_t wireWriteReg(uint8_t address, uint8_t reg, const uint8_t* data, size_t len) {
+  if (!wireBufferValid(data, len, "Wire.writeReg", WireBuf::kRead)) {
+    return kWireErrOther;
+  }
+  xSemaphoreTake(g_wire_mutex, portMAX_DELAY);
+  int32_t result = wireWriteRegLocked(address, reg, data, len);
+  xSemaphoreGive(g_wire_mutex);
+  return result;
+}
+
+static bool wireQueueJob(const WireJob& job, const char* what) {
+  if (!wireBufferValid(job.buf, job.len, what, WireBuf::kQueued)) {
+    return false;
+  }
+  uintptr_t status_addr = reinterpret_cast<uintptr_t>(job.status);
+  if ((status_addr & 0x3u) != 0 ||
+      !syscall_validation::isValidAppBuffer(const_cast<int32_t*>(job.status), sizeof(int32_t))) {
+    Serial.print("[Kernel] ERROR: Invalid status pointer in ");
+    Serial.println(what);
+    return false;
+  }
+
+  *job.status = kWirePending;
+  if (xQueueSend(g_wire_queue, &job, 0) != pdTRUE) {
+    *job.status = kWireErrOther;  // queue full - the app may retry
+    return false;
+  }
+  return true;
+}
+
+static bool wireReadBufAsync(uint8_t address, uint8_t reg, uint8_t* buf, size_t len,
+                             volatile int32_t* status) {
+  if (len == 0) {
+    return false;
+  }
+  return wireQueueJob(WireJob{address, reg, false, buf, len, status}, "Wire.readBufAsync");
+}
+
+static bool wireWriteRegAsync(uint8_t address, uint8_t reg, const uint8_t* data, size_t len,
+                              volatile int32_t* status) {
+  // The worker only reads from buf for writes
+  return wireQueueJob(WireJob{address, reg, true, const_cast<uint8_t*>(data), len, status},
+                      "Wire.writeRegAsync");
 }
 }  // namespace syscall_safe_wrappers
 
@@ -175,6 +726,124 @@ void softwareReset() {
   watchdog_reboot(0, 0, 0);  // Use watchdog to reset
 }
 
+// =====================================================================
+// GPIO port wrappers
+// =====================================================================
+// Whole-port operations work on pins the app has claimed. A claim puts
+// the pins under SIO control and records them as app-owned; from then on
+// the app may also drive them through the SIO set/clr/xor registers
+// directly (app/include/gpio_fast.h) without any syscall.
+
+namespace syscall_safe_wrappers {
+static constexpr uint32_t kGpioPortMask =
+    (NUM_BANK0_GPIOS >= 32) ? 0xFFFFFFFFu : ((1u << (NUM_BANK0_GPIOS & 31)) - 1u);
+
+static volatile uint32_t g_gpio_app_owned = 0;
+
+static bool gpioClaim(uint32_t mask) {
+  if ((mask & ~kGpioPortMask) != 0 || (mask & kRadioPinMask) != 0) {
+    Serial.println("[Kernel] ERROR: gpio_claim requested a reserved or nonexistent pin");
+    return false;
+  }
+  bool granted = true;
+  taskENTER_CRITICAL();
+  if ((mask & g_gpio_app_owned) != mask) {
+    // A pin routed to a peripheral (UART, SPI, I2C, PWM...) is in use
+    for (uint32_t pin = 0; pin < 32; ++pin) {
+      if ((mask & ~g_gpio_app_owned & (1u << pin)) == 0) {
+        continue;
+      }
+      gpio_function_t fn = gpio_get_function(pin);
+      if (fn != GPIO_FUNC_SIO && fn != GPIO_FUNC_NULL) {
+        granted = false;
+        break;
+      }
+    }
+    if (granted) {
+      gpio_init_mask(mask & ~g_gpio_app_owned);
+      g_gpio_app_owned |= mask;
+    }
+  }
+  taskEXIT_CRITICAL();
+  if (!granted) {
+    Serial.println("[Kernel] ERROR: gpio_claim requested a pin used by a peripheral");
+  }
+  return granted;
+}
+
+static void gpioRelease(uint32_t mask) {
+  taskENTER_CRITICAL();
+  g_gpio_app_owned &= ~mask;
+  taskEXIT_CRITICAL();
+}
+
+static uint32_t gpioClaimed() {
+  return g_gpio_app_owned;
+}
+
+static void gpioPutMasked(uint32_t mask, uint32_t value) {
+  gpio_put_masked(mask & g_gpio_app_owned, value);
+}
+
+static void gpioSetDirMasked(uint32_t mask, uint32_t value) {
+  gpio_set_dir_masked(mask & g_gpio_app_owned, value);
+}
+
+// Reading is harmless, so every bank 0 pin is reported
+static uint32_t gpioGetAll() {
+  return gpio_get_all() & kGpioPortMask;
+}
+}  // namespace syscall_safe_wrappers
+
+// =====================================================================
+// Code overlay wrappers
+// =====================================================================
+
+namespace syscall_safe_wrappers {
+// Pin the code page holding `addr` (e.g. a function pointer) so it is
+// never evicted; calls nest
+static bool cachePin(uintptr_t addr) {
+  uint32_t page_id = code_cache_find_page(static_cast<uint32_t>(addr & ~static_cast<uintptr_t>(1u)));
+  if (page_id == UINT32_MAX) {
+    Serial.print("[Kernel] ERROR: Cache_pin address 0x");
+    Serial.print(addr, HEX);
+    Serial.println(" is not app code");
+    return false;
+  }
+  return code_cache_pin(page_id);
+}
+
+static void cacheUnpin(uintptr_t addr) {
+  uint32_t page_id = code_cache_find_page(static_cast<uint32_t>(addr & ~static_cast<uintptr_t>(1u)));
+  if (page_id != UINT32_MAX) {
+    code_cache_unpin(page_id);
+  }
+}
+
+static bool cacheSetPartition(uint32_t core0_slots) {
+  return code_cache_set_partition(core0_slots);
+}
+
+// Stats: loads, hits, evictions, faults, stall_us, max_stall_us
+static bool cacheGetStats(uint32_t core, uint32_t* out) {
+  if (!syscall_validation::isValidAppWritable(out, 6 * sizeof(uint32_t))) {
+    Serial.println("[Kernel] ERROR: Invalid buffer in Cache_getStats");
+    return false;
+  }
+  CodeCacheStats stats;
+  if (!code_cache_get_stats(core, &stats)) {
+    return false;
+  }
+  out[0] = stats.loads;
+  out[1] = stats.hits;
+  out[2] = stats.evictions;
+  out[3] = stats.faults;
+  out[4] = stats.stall_us;
+  out[5] = stats.max_stall_us;
+  return true;
+}
+}  // namespace syscall_safe_wrappers
+
 // =====================================================================
 // Interrupt support
 // =====================================================================
@@ -184,37 +853,41 @@ void softwareReset() {
 #define FALLING 0x02
 #define RISING  0x03
 
-// Storage for ISR function pointers (max 30 GPIO pins)
+// Storage for ISR function pointers (max 30 GPIO pins). Deferred handlers
+// take a uint32_t argument and are queued to the AppDefer task instead.
 static void (*isr_handlers[30])(void) = {nullptr};
+static bool isr_deferred[30] = {false};
 
 // GPIO interrupt callback - dispatches to app ISR
 static void gpio_isr_callback(uint gpio, uint32_t events) {
   if (gpio < 30 && isr_handlers[gpio] != nullptr) {
-    // Validate ISR pointer is in SRAM (app code region)
-    uintptr_t isr_addr = reinterpret_cast<uintptr_t>(isr_handlers[gpio]);
-    if (syscall_validation::isValidAppPointer(reinterpret_cast<const void*>(isr_addr), 0)) {
-      // Call the app ISR
+    // Checked when attached
+    if (isr_deferred[gpio]) {
+      app_defer_queue(reinterpret_cast<uintptr_t>(isr_handlers[gpio]), APP_DEFER_GPIO_ARG(gpio, events));
+    } else {
       isr_handlers[gpio]();
     }
   }
 }
 
-// Attach interrupt handler to GPIO pin
-// NOTE: Must NOT be named attachInterrupt, because Arduino core provides overloads and
-// the generated jump table needs an unambiguous function pointer.
-void KernelAttachInterrupt(uint8_t pin, uintptr_t isr_addr, int mode) {
+static void attachGpioInterrupt(uint8_t pin, uintptr_t isr_addr, int mode, bool deferred,
+                                const char* what) {
   if (pin >= 30) {
-    Serial.print("[Kernel] ERROR: attachInterrupt pin ");
+    Serial.print("[Kernel] ERROR: ");
+    Serial.print(what);
+    Serial.print(" pin ");
     Serial.print(pin);
     Serial.println(" out of range");
     return;
   }
   
-  // Validate ISR pointer is in SRAM
-  if (!syscall_validation::isValidAppPointer(reinterpret_cast<const void*>(isr_addr), 0)) {
-    Serial.print("[Kernel] ERROR: attachInterrupt ISR pointer 0x");
+  // Validate ISR pointer is app code
+  if (!syscall_validation::isValidAppCode(isr_addr)) {
+    Serial.print("[Kernel] ERROR: ");
+    Serial.print(what);
+    Serial.print(" ISR pointer 0x");
     Serial.print(isr_addr, HEX);
-    Serial.println(" is not in SRAM");
+    Serial.println(" is not app code");
     return;
   }
   
@@ -227,18 +900,35 @@ void KernelAttachInterrupt(uint8_t pin, uintptr_t isr_addr, int mode) {
   } else if (mode == CHANGE) {
     pico_mode = GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL;
   } else {
-    Serial.print("[Kernel] ERROR: attachInterrupt invalid mode ");
+    Serial.print("[Kernel] ERROR: ");
+    Serial.print(what);
+    Serial.print(" invalid mode ");
     Serial.println(mode);
     return;
   }
   
-  // Store ISR handler
+  // Store ISR handler; the pin's interrupt is off while it changes
+  gpio_set_irq_enabled(pin, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, false);
   isr_handlers[pin] = reinterpret_cast<void (*)(void)>(isr_addr);
+  isr_deferred[pin] = deferred;
   
   // Configure GPIO interrupt
   gpio_set_irq_enabled_with_callback(pin, pico_mode, true, gpio_isr_callback);
 }
 
+// Attach interrupt handler to GPIO pin
+// NOTE: Must NOT be named attachInterrupt, because Arduino core provides overloads and
+// the generated jump table needs an unambiguous function pointer.
+void KernelAttachInterrupt(uint8_t pin, uintptr_t isr_addr, int mode) {
+  attachGpioInterrupt(pin, isr_addr, mode, false, "attachInterrupt");
+}
+
+// The interrupt only queues handler(APP_DEFER_GPIO_ARG(pin, events)); the
+// AppDefer task runs it (see app_defer.h). See note above about naming.
+void KernelAttachInterruptDeferred(uint8_t pin, uintptr_t handler_addr, int mode) {
+  attachGpioInterrupt(pin, handler_addr, mode, true, "attachInterruptDeferred");
+}
+
 // Detach interrupt handler from GPIO pin
 // See note above about naming.
 void KernelDetachInterrupt(uint8_t pin) {
@@ -251,6 +941,7 @@ void KernelDetachInterrupt(uint8_t pin) {
   
   // Clear ISR handler
   isr_handlers[pin] = nullptr;
+  isr_deferred[pin] = false;
 }
 
 // =====================================================================
@@ -327,7 +1018,7 @@ static const char* wifiGetHostname() {
 
 // WiFi MAC address getter - copies to app buffer
 static uint8_t* wifiMacAddress(uint8_t* mac) {
-  if (!syscall_validation::isValidAppPointer(mac, 6)) {
+  if (!syscall_validation::isValidAppWritable(mac, 6)) {
     Serial.println("[Kernel] ERROR: Invalid MAC buffer pointer in WiFi.macAddress");
     return nullptr;
   }
@@ -499,11 +1190,11 @@ static void multicoreLaunchCore1Safe(uintptr_t entry_addr) {
     Serial.println("[Kernel] ERROR: multicore_launch_core1 called with NULL function pointer");
     return;
   }
-  // Validate function pointer is in SRAM (app code region)
-  if (!syscall_validation::isValidAppPointer(reinterpret_cast<const void*>(entry_addr), 0)) {
+  // Validate function pointer is app code
+  if (!syscall_validation::isValidAppCode(entry_addr)) {
     Serial.print("[Kernel] ERROR: multicore_launch_core1 function pointer 0x");
     Serial.print(entry_addr, HEX);
-    Serial.println(" is not in SRAM");
+    Serial.println(" is not app code");
     return;
   }
   
@@ -586,7 +1277,15 @@ extern "C" void core1_kernel_entry(void) {
     core1_flag = Core1StatusPtr();
     *core1_flag = 0xDEADBEEF;
   }
+
+  // App code on this core runs on the stack below this frame
+  uintptr_t sp;
+  __asm__ volatile("mov %0, sp" : "=r"(sp));
+  g_core1_stack_top = sp;
   
+  // Page misses on this core fault into the overlay loader like on core 0
+  code_cache_enable_demand_paging();
+
   // Get the app entry function address from shared memory
   uint32_t entry_addr = core1_entry_addr;
   
@@ -624,14 +1323,11 @@ extern "C" void core1_kernel_entry(void) {
   }
   
   // Cast to function pointer and call the app function
-  // The function is now in the overlay window at CODE_OVERLAY_BASE
+  // The function's page is now at its linked address in the overlay window
   void (*entry)(void) = reinterpret_cast<void (*)(void)>(entry_addr);
   
-  // Call the app entry function
-  // NOTE: This is a chicken-and-egg problem: we need __syscall_raw() loaded,
-  // but we don't know which page it's in. The overlay system should ideally
-  // handle this automatically, but it doesn't. For now, we'll try loading
-  // common pages and hope __syscall_raw() is accessible.
+  // Call the app entry function. Other pages it reaches are loaded on
+  // demand; __syscall_raw() lives outside the overlay in .syscall_infra.
   entry();
   
   // If we return (shouldn't happen for infinite loops), signal error
@@ -686,6 +1382,9 @@ static uintptr_t ProxySyscallToCore0(uint16_t id, const uintptr_t args[30]) {
     g_core1_sys_msg.args[i] = args[i];
   }
 
+  uintptr_t sp;
+  __asm__ volatile("mov %0, sp" : "=r"(sp));
+  g_core1_sys_msg.caller_sp = sp;
   g_core1_sys_msg.result = 0;
   g_core1_sys_msg.done = 0;
   __dmb();
@@ -719,6 +1418,7 @@ static void Core1SyscallWorkerTask(void* /*pv_parameters*/) {
       args[i] = g_core1_sys_msg.args[i];
     }
 
+    syscall_validation::setProxiedAppStack(g_core1_sys_msg.caller_sp, g_core1_stack_top);
     uintptr_t result = DispatchSyscall(g_core1_sys_msg.id, args);
     g_core1_sys_msg.result = result;
     __dmb();
@@ -0,0 +1,24 @@
+#pragma once
+#include <stdint.h>
+#include <Arduino.h>  // For Serial
+
+// Helpers shared by the kernel modules
+
+// Pico 2 W: GPIO23 (WL_ON), 24 (WL_D), 25 (WL_CS) and 29 (WL_CLK) talk to
+// the CYW43 radio; no syscall may hand them to the app or reconfigure them
+static constexpr uint32_t kRadioPinMask = (1u << 23) | (1u << 24) | (1u << 25) | (1u << 29);
+
+// True in an exception handler (IPSR holds the exception number)
+static inline bool inInterrupt() {
+  uint32_t ipsr;
+  __asm__ volatile("mrs %0, ipsr" : "=r"(ipsr));
+  return ipsr != 0;
+}
+
+// Prints "[Kernel] ERROR: <what>: <why>"
+static inline void reportError(const char* what, const char* why) {
+  Serial.print("[Kernel] ERROR: ");
+  Serial.print(what);
+  Serial.print(": ");
+  Serial.println(why);
+}
@@ -4,6 +4,7 @@
 #include "generated/raw_data.h"
 #include "generated/app_page_map.h"
 #include "code_cache.h"
+#include "app_header.h"
 
 #define kAppDst (reinterpret_cast<uint8_t*>(0x20030000))
 #define kSramSize (0x00070000u)
@@ -104,27 +105,10 @@ static void zero_region(uint8_t* start, uint8_t* end, const char* name) {
 // Also loads any code pages needed for setup/loop functions
 extern "C" void zero_app_bss(void) {
   // Read app header to get section boundaries
-  struct AppHeader {
-    uint32_t magic;
-    uint32_t version;
-    void (*app_setup)(void);
-    void (*app_loop)(void);
-    void* syscall_gate;
-    void* data_start;
-    void* data_end;
-    void* bss_start;
-    void* bss_end;
-    uint32_t* bss_marker;
-    void (**init_array_start)(void);
-    void (**init_array_end)(void);
-    void (**fini_array_start)(void);
-    void (**fini_array_end)(void);
-  };
-  
   AppHeader* hdr = reinterpret_cast<AppHeader*>(kAppDst);
   
   // Validate header
-  if (hdr->magic != 0x41505041u) {  // "APPA"
+  if (hdr->magic != kAppMagic) {
     return;  // Invalid header, skip zeroing
   }
   
@@ -186,27 +170,10 @@ extern "C" void zero_app_bss(void) {
 // Calls all global constructors for C++ global objects
 // Must be called after zero_app_bss() and before app_setup()
 extern "C" void call_app_constructors(void) {
-  struct AppHeader {
-    uint32_t magic;
-    uint32_t version;
-    void (*app_setup)(void);
-    void (*app_loop)(void);
-    void* syscall_gate;
-    void* data_start;
-    void* data_end;
-    void* bss_start;
-    void* bss_end;
-    uint32_t* bss_marker;
-    void (**init_array_start)(void);
-    void (**init_array_end)(void);
-    void (**fini_array_start)(void);
-    void (**fini_array_end)(void);
-  };
-  
   AppHeader* hdr = reinterpret_cast<AppHeader*>(kAppDst);
   
   // Validate header
-  if (hdr->magic != 0x41505041u) {  // "APPA"
+  if (hdr->magic != kAppMagic) {
     return;  // Invalid header, skip
   }
   
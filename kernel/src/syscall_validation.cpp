@@ -0,0 +1,121 @@
+#include <Arduino.h>
+#include <stdint.h>
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "syscall_validation.h"
+#include "app_tasks.h"
+#include "code_cache.h"
+#include "kernel_util.h"
+
+#define SCB_VTOR (*(volatile uint32_t*)0xE000ED08u)
+
+// Task_create tasks, AppTask (the setup() task before it), AppDefer,
+// and one spare
+#define kMaxAppStacks (APP_MAX_TASKS + 3)
+
+namespace syscall_validation {
+
+struct AppStack {
+  TaskHandle_t task;
+  uintptr_t top;
+};
+
+static AppStack g_stacks[kMaxAppStacks];
+
+// Core1Sys and the core 1 stack range of the syscall it is running
+static TaskHandle_t g_proxy_task = nullptr;
+static uintptr_t g_proxy_sp = 0;
+static uintptr_t g_proxy_top = 0;
+
+static inline uintptr_t currentSp() {
+  uintptr_t sp;
+  __asm__ volatile("mov %0, sp" : "=r"(sp));
+  return sp;
+}
+
+static inline bool inRange(uintptr_t addr, size_t len, uintptr_t low, uintptr_t high) {
+  return addr >= low && addr < high && len <= high - addr;
+}
+
+bool isValidAppBuffer(const void* ptr, size_t len) {
+  const uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+  if (!inRange(addr, len, kAppWindowBase, kAppWindowEnd)) {
+    return false;
+  }
+  // Below the code pages (image, data) or above them (heap)
+  const uintptr_t code_end = code_cache_code_end();
+  return (addr < kAppCodeBase && len <= kAppCodeBase - addr) || addr >= code_end;
+}
+
+bool isValidAppWritable(const void* ptr, size_t len) {
+  if (isValidAppBuffer(ptr, len)) {
+    return true;
+  }
+  const uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+  const uintptr_t sp = currentSp();
+  if (inInterrupt()) {
+    // Handlers share the main stack, which starts at the vector table's
+    // initial SP (FreeRTOS resets MSP to it when the scheduler starts)
+    const uintptr_t msp_top = *reinterpret_cast<const volatile uint32_t*>(SCB_VTOR);
+    return inRange(addr, len, sp, msp_top);
+  }
+  // Entries only change for their own task or one being deleted, so the
+  // caller's entry is stable while it looks it up
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  if (self == g_proxy_task) {
+    return inRange(addr, len, g_proxy_sp, g_proxy_top);
+  }
+  for (int i = 0; i < kMaxAppStacks; ++i) {
+    if (g_stacks[i].task == self) {
+      return inRange(addr, len, sp, g_stacks[i].top);
+    }
+  }
+  return false;
+}
+
+void registerAppStack(void) {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  const uintptr_t top = currentSp();
+  AppStack* entry = nullptr;
+  taskENTER_CRITICAL();
+  for (int i = 0; i < kMaxAppStacks; ++i) {
+    if (g_stacks[i].task == self) {
+      entry = &g_stacks[i];
+      break;
+    }
+    if (entry == nullptr && g_stacks[i].task == nullptr) {
+      entry = &g_stacks[i];
+    }
+  }
+  if (entry != nullptr) {
+    entry->task = self;
+    entry->top = top;
+  }
+  taskEXIT_CRITICAL();
+  if (entry == nullptr) {
+    Serial.println("[Kernel] ERROR: Too many app stacks; stack buffers will be rejected");
+  }
+}
+
+void unregisterAppStack(TaskHandle_t task) {
+  if (task == nullptr) {
+    return;
+  }
+  taskENTER_CRITICAL();
+  for (int i = 0; i < kMaxAppStacks; ++i) {
+    if (g_stacks[i].task == task) {
+      g_stacks[i].task = nullptr;
+      break;
+    }
+  }
+  taskEXIT_CRITICAL();
+}
+
+void setProxiedAppStack(uintptr_t sp, uintptr_t top) {
+  g_proxy_task = xTaskGetCurrentTaskHandle();
+  g_proxy_sp = sp;
+  g_proxy_top = top;
+}
+
+}  // namespace syscall_validation
@@ -2,6 +2,8 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <Arduino.h>  // For Serial
+#include <FreeRTOS.h>
+#include <task.h>
 
 // SRAM region considered safe for passing pointers between app and kernel.
 //
@@ -15,11 +17,42 @@
 //
 // So we validate against the full RP2350 SRAM span used by this project.
 #define kSramBaseAddr (0x20000000u)
-#define kSramSize (0x000A0000u)  // 640KB -> end at 0x200A0000
+#define kSramSize (0x00082000u)  // 520KB -> end at 0x20082000 (top of SCRATCH_Y)
 #define kSramEndAddr (kSramBaseAddr + kSramSize)
 
+// The app's own RAM: image, .data/.bss, overlay window and heap, up to the
+// heap limit (__heap_end__ in app/linker/memmap_app_ram.ld). SCRATCH_X/Y
+// above it hold the core stacks and the MSP, so they are never app memory.
+#define kAppWindowBase (0x20030000u)
+#define kAppWindowEnd (0x20080000u)
+// Loaded code pages sit at the bottom of the overlay window, from here to
+// code_cache_code_end(); the heap follows them
+#define kAppCodeBase (0x20040000u)
+#define kScratchBase (0x20080000u)
+#define kScratchEnd (0x20082000u)
+static_assert(kAppWindowEnd <= kScratchBase, "the app window must not reach SCRATCH_X/Y");
+
 namespace syscall_validation {
 
+// Three checks, from most to least permissive:
+//
+//   isValidAppPointer   buffers the kernel only reads (strings, tx data).
+//                       Any SRAM, since the app also passes pointers the
+//                       kernel handed out earlier (e.g. WiFi.SSID()).
+//   isValidAppWritable  buffers the kernel writes during the call: the app
+//                       window, or the live part of the calling stack.
+//   isValidAppBuffer    buffers the kernel or DMA still uses after the call
+//                       returns: the app window only, as a stack frame may
+//                       be gone by then.
+//
+// Neither of the last two accepts the app's loaded code pages: a write
+// there would corrupt code the other core may be running.
+//
+// The writable check is what keeps a stray app pointer from landing in
+// kernel statics or another task's stack. Each stack that runs app code is
+// registered with registerAppStack(); the caller's live stack is then the
+// range from its current SP up to the registered top.
+
 // Checks if pointer is within app SRAM region
 // Also validates buffer doesn't overflow if len > 0
 inline bool isValidAppPointer(const void* ptr, size_t len) {
@@ -47,4 +80,24 @@ inline bool isValidAppString(const char* str) {
   return valid;
 }
 
-}
\ No newline at end of file
+bool isValidAppBuffer(const void* ptr, size_t len);
+
+bool isValidAppWritable(const void* ptr, size_t len);
+
+// Thumb function address inside the app window (resident or overlay code)
+inline bool isValidAppCode(uintptr_t fn) {
+  const uintptr_t addr = fn & ~static_cast<uintptr_t>(1u);
+  return (fn & 1u) != 0 && addr >= kAppWindowBase && addr <= kAppWindowEnd - 2;
+}
+
+// Record the calling task's stack as one that runs app code. Call before
+// the task first enters the app; frames above the current SP are not
+// considered app memory.
+void registerAppStack(void);
+void unregisterAppStack(TaskHandle_t task);
+
+// Core1Sys runs syscalls on behalf of core 1: its "caller stack" is core
+// 1's stack, from the SP core 1 had when it made the call up to `top`.
+void setProxiedAppStack(uintptr_t sp, uintptr_t top);
+
+}  // namespace syscall_validation
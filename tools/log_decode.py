@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+# Decodes APP_LOG binary records from the app's Serial output back into text
+# Plain text on the same stream is passed through unchanged.
+#
+#   python tools/log_decode.py capture.bin
+#   python tools/log_decode.py --port COM5          (needs pyserial)
+#   python tools/log_decode.py --dict app.elf -     (dictionary straight from an ELF)
+
+from __future__ import annotations
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+from log_gen import extract_formats
+
+SYNC = 0x1E
+HEADER_SIZE = 6  # id (u16) + timestamp (u32)
+
+DEFAULT_DICT = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            "..", "app", "src", "generated", "log_dict.json")
+
+# printf conversion: flags, width, precision, length modifier, conversion
+CONVERSION_RE = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<prec>\*|\d+))?"
+    r"(?P<length>hh|h|ll|l|L|z|j|t)?(?P<conv>[diouxXcfFeEgGsp%])")
+
+
+class Format:
+    """A format string split into argument kinds and a Python %-format."""
+
+    def __init__(self, text: str):
+        self.kinds = []
+        parts = []
+        pos = 0
+        for m in CONVERSION_RE.finditer(text):
+            parts.append(text[pos:m.start()].replace("%", "%%"))
+            pos = m.end()
+            conv = m.group("conv")
+            if conv == "%":
+                parts.append("%%")
+                continue
+            for field in ("width", "prec"):
+                if m.group(field) == "*":
+                    self.kinds.append("i32")
+            wide = m.group("length") in ("ll", "j")
+            if conv in "di":
+                self.kinds.append("i64" if wide else "i32")
+            elif conv in "ouxXc":
+                self.kinds.append("u64" if wide else "u32")
+            elif conv == "p":
+                self.kinds.append("u32")
+                parts.append("0x%08x")
+                continue
+            elif conv in "fFeEgG":
+                self.kinds.append("f32")
+            else:
+                self.kinds.append("str")
+            spec = "%" + m.group("flags") + (m.group("width") or "")
+            if m.group("prec") is not None:
+                spec += "." + m.group("prec")
+            parts.append(spec + conv)
+        parts.append(text[pos:].replace("%", "%%"))
+        self.pyformat = "".join(parts)
+
+    def render(self, args: bytes) -> str | None:
+        """Format the raw argument bytes, or None if they do not fit."""
+        values = []
+        pos = 0
+        try:
+            for kind in self.kinds:
+                if kind == "str":
+                    n = args[pos]
+                    values.append(args[pos + 1:pos + 1 + n].decode("utf-8", errors="replace"))
+                    pos += 1 + n
+                    continue
+                code, size = {"i32": ("<i", 4), "u32": ("<I", 4), "i64": ("<q", 8),
+                              "u64": ("<Q", 8), "f32": ("<f", 4)}[kind]
+                values.append(struct.unpack_from(code, args, pos)[0])
+                pos += size
+        except (IndexError, struct.error):
+            return None
+        if pos != len(args):
+            return None
+        try:
+            return self.pyformat % tuple(values)
+        except (TypeError, ValueError, OverflowError):
+            return None
+
+
+def load_dictionary(path: str) -> dict[int, Format]:
+    with open(path, "rb") as f:
+        is_elf = f.read(4) == b"\x7fELF"
+    if is_elf:
+        formats = extract_formats(path)
+    else:
+        with open(path, encoding="utf-8") as f:
+            formats = {int(k): v for k, v in json.load(f)["formats"].items()}
+    return {k: Format(v) for k, v in formats.items()}
+
+
+class Decoder:
+    """Splits a byte stream into text and binary records."""
+
+    def __init__(self, formats: dict[int, Format], out):
+        self.formats = formats
+        self.out = out
+        self.buf = bytearray()
+        self.last_ts = None
+        self.epoch = 0
+
+    def _timestamp(self, ts: int) -> float:
+        # The 32-bit microsecond counter wraps every ~71 minutes. Records
+        # from the two cores may arrive slightly out of order, so only a
+        # large backwards step counts as a wrap.
+        if self.last_ts is not None and ts < self.last_ts and self.last_ts - ts > 1 << 31:
+            self.epoch += 1 << 32
+        self.last_ts = ts
+        return (self.epoch + ts) / 1e6
+
+    def _record(self, payload: bytes) -> str | None:
+        if len(payload) < HEADER_SIZE:
+            return None
+        rec_id, ts = struct.unpack_from("<HI", payload, 0)
+        fmt = self.formats.get(rec_id)
+        if fmt is None:
+            return None
+        text = fmt.render(payload[HEADER_SIZE:])
+        if text is None:
+            return None
+        return f"[{self._timestamp(ts):14.6f}] {text}\n"
+
+    def feed(self, data: bytes, final: bool = False):
+        self.buf += data
+        pos = 0
+        while True:
+            sync = self.buf.find(SYNC, pos)
+            if sync < 0:
+                self._text(self.buf[pos:])
+                pos = len(self.buf)
+                break
+            self._text(self.buf[pos:sync])
+            pos = sync
+            if len(self.buf) - sync < 2 or len(self.buf) - sync < 2 + self.buf[sync + 1]:
+                if not final:
+                    break  # wait for the rest of the record
+                self._text(self.buf[sync:sync + 1])
+                pos = sync + 1
+                continue
+            end = sync + 2 + self.buf[sync + 1]
+            line = self._record(bytes(self.buf[sync + 2:end]))
+            if line is None:
+                # Not a record after all - pass the byte through as text
+                self._text(self.buf[sync:sync + 1])
+                pos = sync + 1
+            else:
+                self.out.write(line)
+                pos = end
+        del self.buf[:pos]
+        self.out.flush()
+
+    def _text(self, data: bytes):
+        if data:
+            self.out.write(data.decode("utf-8", errors="replace"))
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Decode APP_LOG records from app Serial output")
+    parser.add_argument("input", nargs="?", default="-",
+                        help="captured output file, or - for stdin (default)")
+    parser.add_argument("--dict", default=DEFAULT_DICT,
+                        help="log_dict.json from the build, or the app.elf itself")
+    parser.add_argument("--port", help="read live from a serial port (requires pyserial)")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    try:
+        formats = load_dictionary(args.dict)
+    except (OSError, ValueError, KeyError) as e:
+        print(f"Error: cannot load log dictionary: {e}", file=sys.stderr)
+        return 1
+
+    decoder = Decoder(formats, sys.stdout)
+    try:
+        if args.port:
+            try:
+                import serial
+            except ImportError:
+                print("Error: --port requires pyserial (pip install pyserial)", file=sys.stderr)
+                return 1
+            with serial.Serial(args.port, args.baud, timeout=0.1) as port:
+                while True:
+                    decoder.feed(port.read(4096))
+        else:
+            stream = sys.stdin.buffer if args.input == "-" else open(args.input, "rb")
+            with stream:
+                while True:
+                    chunk = stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+                    if not chunk:
+                        break
+                    decoder.feed(chunk)
+            decoder.feed(b"", final=True)
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+# Extracts the APP_LOG format-string dictionary from app.elf
+# Record ids are offsets into the non-loaded .logfmt section (see app/include/app_log.h)
+
+from __future__ import annotations
+import json
+import struct
+import sys
+
+LOGFMT_SECTION = ".logfmt"
+
+
+def read_sections(elf_path: str) -> dict[str, bytes]:
+    """Return {name: contents} for every section of a little-endian ELF32 file."""
+    with open(elf_path, "rb") as f:
+        data = f.read()
+
+    if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+        raise ValueError(f"{elf_path}: not a little-endian ELF32 file")
+
+    e_shoff, = struct.unpack_from("<I", data, 0x20)
+    e_shentsize, e_shnum, e_shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+
+    headers = []
+    for i in range(e_shnum):
+        # sh_name, sh_type, sh_flags, sh_addr, sh_offset, sh_size
+        headers.append(struct.unpack_from("<IIIIII", data, e_shoff + i * e_shentsize))
+
+    names_offset = headers[e_shstrndx][4]
+    sections = {}
+    for sh_name, sh_type, _flags, _addr, sh_offset, sh_size in headers:
+        end = data.index(b"\0", names_offset + sh_name)
+        name = data[names_offset + sh_name:end].decode("ascii")
+        # SHT_NOBITS sections have no file contents
+        sections[name] = b"" if sh_type == 8 else data[sh_offset:sh_offset + sh_size]
+    return sections
+
+
+def extract_formats(elf_path: str) -> dict[int, str]:
+    """Map record id -> format string. The section is linked at address 0,
+    so a string's offset in it is its id."""
+    blob = read_sections(elf_path).get(LOGFMT_SECTION, b"")
+    formats = {}
+    offset = 0
+    while offset < len(blob):
+        end = blob.find(b"\0", offset)
+        if end < 0:
+            end = len(blob)
+        if end > offset:
+            formats[offset] = blob[offset:end].decode("utf-8", errors="replace")
+        offset = end + 1
+    return formats
+
+
+def main() -> int:
+    if len(sys.argv) != 3:
+        print("Usage: log_gen.py <app.elf> <log_dict.json>", file=sys.stderr)
+        return 1
+
+    elf_path, out_path = sys.argv[1], sys.argv[2]
+    try:
+        formats = extract_formats(elf_path)
+    except (OSError, ValueError) as e:
+        print(f"Error: {e}", file=sys.stderr)
+        return 1
+
+    with open(out_path, "w", encoding="utf-8") as f:
+        json.dump({"formats": {str(k): v for k, v in sorted(formats.items())}}, f, indent=2)
+        f.write("\n")
+
+    print(f"Extracted {len(formats)} log format strings to {out_path}", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,436 @@
+#!/usr/bin/env python3
+# Assembles app/pio/*.pio into app/src/generated/pio_programs.h
+# Accepts the pioasm syntax for PIO version 0 programs (RP2040/RP2350):
+# .program, .side_set N [opt] [pindirs], .wrap_target, .wrap, .origin,
+# .define, labels (optionally public) and all nine instructions with side
+# sets and delays. Every instruction is range-checked; any error fails the
+# build with file:line. % c-sdk { ... %} blocks are skipped.
+
+from __future__ import annotations
+import os
+import re
+import sys
+from dataclasses import dataclass, field
+
+MAX_INSTRUCTIONS = 32
+
+JMP_CONDITIONS = {"": 0, "!x": 1, "x--": 2, "!y": 3, "y--": 4, "x!=y": 5, "pin": 6, "!osre": 7}
+WAIT_SOURCES = {"gpio": 0, "pin": 1, "irq": 2}
+IN_SOURCES = {"pins": 0, "x": 1, "y": 2, "null": 3, "isr": 6, "osr": 7}
+OUT_DESTS = {"pins": 0, "x": 1, "y": 2, "null": 3, "pindirs": 4, "pc": 5, "isr": 6, "exec": 7}
+MOV_DESTS = {"pins": 0, "x": 1, "y": 2, "exec": 4, "pc": 5, "isr": 6, "osr": 7}
+MOV_SOURCES = {"pins": 0, "x": 1, "y": 2, "null": 3, "status": 5, "isr": 6, "osr": 7}
+SET_DESTS = {"pins": 0, "x": 1, "y": 2, "pindirs": 4}
+
+EXPR_CHARS = re.compile(r"^[0-9a-fA-FxXbB_+\-*/%()<>&|~ ]+$")
+IDENT = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
+
+
+class PioError(Exception):
+    pass
+
+
+@dataclass
+class Line:
+    number: int
+    text: str
+
+
+@dataclass
+class Program:
+    name: str
+    source: str
+    line: int
+    sideset_bits: int = 0       # value bits, without the enable bit
+    sideset_opt: bool = False
+    sideset_pindirs: bool = False
+    origin: int = -1
+    wrap_target: int | None = None
+    wrap: int | None = None
+    defines: dict[str, int] = field(default_factory=dict)
+    labels: dict[str, int] = field(default_factory=dict)
+    public: list[str] = field(default_factory=list)
+    public_defines: list[str] = field(default_factory=list)
+    body: list[tuple[Line, str]] = field(default_factory=list)  # (line, instruction text)
+    code: list[tuple[int, str]] = field(default_factory=list)   # (word, instruction text)
+
+
+def evaluate(text: str, symbols: dict[str, int], where: str) -> int:
+    """Integer expression over numbers and .define / label symbols."""
+    expr = re.sub(r"[A-Za-z_][A-Za-z0-9_]*",
+                  lambda m: str(symbols[m.group(0)]) if m.group(0) in symbols else m.group(0),
+                  text.strip())
+    if not expr or not EXPR_CHARS.match(expr) or re.search(r"[A-Za-z_]", re.sub(r"0[xXbB][0-9a-fA-F_]+", "", expr)):
+        raise PioError(f"{where}: bad expression '{text.strip()}'")
+    try:
+        value = eval(expr.replace("/", "//"), {"__builtins__": {}}, {})
+    except Exception:
+        raise PioError(f"{where}: bad expression '{text.strip()}'") from None
+    if not isinstance(value, int):
+        raise PioError(f"{where}: bad expression '{text.strip()}'")
+    return value
+
+
+def check_range(value: int, low: int, high: int, what: str, where: str) -> int:
+    if not low <= value <= high:
+        raise PioError(f"{where}: {what} {value} out of range {low}..{high}")
+    return value
+
+
+def split_operands(text: str) -> list[str]:
+    return [part.strip() for part in text.split(",")] if text.strip() else []
+
+
+def parse_file(path: str) -> list[Program]:
+    with open(path, "r", encoding="utf-8") as f:
+        raw_lines = f.read().splitlines()
+
+    programs: list[Program] = []
+    file_defines: dict[str, int] = {}
+    current: Program | None = None
+    in_code_block = False
+
+    for number, raw in enumerate(raw_lines, 1):
+        where = f"{path}:{number}"
+        text = re.split(r"//|;", raw, maxsplit=1)[0].strip()
+        if in_code_block:
+            if raw.strip().startswith("%}"):
+                in_code_block = False
+            continue
+        if raw.strip().startswith("%"):
+            in_code_block = True
+            continue
+        if not text:
+            continue
+
+        if text.startswith("."):
+            parts = text.split(None, 1)
+            directive, rest = parts[0], parts[1] if len(parts) > 1 else ""
+            defines = current.defines if current else file_defines
+            if directive == ".program":
+                if not IDENT.match(rest.strip()):
+                    raise PioError(f"{where}: bad program name '{rest.strip()}'")
+                current = Program(rest.strip(), path, number, defines=dict(file_defines))
+                programs.append(current)
+            elif directive == ".define":
+                tokens = rest.split(None, 1)
+                public = bool(tokens) and tokens[0] == "public"
+                if public:
+                    tokens = tokens[1].split(None, 1) if len(tokens) > 1 else []
+                if len(tokens) < 2 or not IDENT.match(tokens[0]):
+                    raise PioError(f"{where}: .define needs a name and a value")
+                defines[tokens[0]] = evaluate(tokens[1], defines, where)
+                if public and current is not None:
+                    current.public_defines.append(tokens[0])
+            elif directive in (".lang_opt", ".pio_version"):
+                if directive == ".pio_version" and evaluate(rest, {}, where) != 0:
+                    raise PioError(f"{where}: only .pio_version 0 programs are supported")
+            elif current is None:
+                raise PioError(f"{where}: {directive} outside a .program")
+            elif directive == ".side_set":
+                tokens = rest.split()
+                if not tokens:
+                    raise PioError(f"{where}: .side_set needs a bit count")
+                current.sideset_bits = evaluate(tokens[0], current.defines, where)
+                for t in tokens[1:]:
+                    if t == "opt":
+                        current.sideset_opt = True
+                    elif t == "pindirs":
+                        current.sideset_pindirs = True
+                    else:
+                        raise PioError(f"{where}: unknown .side_set option '{t}'")
+                total = current.sideset_bits + (1 if current.sideset_opt else 0)
+                check_range(total, 0 if not current.sideset_opt else 1, 5, "side-set bit count", where)
+            elif directive == ".origin":
+                current.origin = check_range(evaluate(rest, current.defines, where),
+                                             0, MAX_INSTRUCTIONS - 1, "origin", where)
+            elif directive == ".wrap_target":
+                current.wrap_target = len(current.body)
+            elif directive == ".wrap":
+                if not current.body:
+                    raise PioError(f"{where}: .wrap before any instruction")
+                current.wrap = len(current.body) - 1
+            elif directive == ".word":
+                current.body.append((Line(number, text), text))
+            else:
+                raise PioError(f"{where}: unknown directive {directive}")
+            continue
+
+        if current is None:
+            raise PioError(f"{where}: instruction outside a .program")
+
+        # Labels, possibly several and possibly followed by an instruction
+        while True:
+            m = re.match(r"^(public\s+)?([A-Za-z_][A-Za-z0-9_]*)\s*:(.*)$", text)
+            if not m:
+                break
+            label = m.group(2)
+            if label in current.labels:
+                raise PioError(f"{where}: label '{label}' defined twice")
+            current.labels[label] = len(current.body)
+            if m.group(1):
+                current.public.append(label)
+            text = m.group(3).strip()
+        if text:
+            current.body.append((Line(number, text), text))
+
+    for program in programs:
+        assemble(program)
+    return programs
+
+
+def delay_side_field(program: Program, side: int | None, delay: int, where: str) -> int:
+    total = program.sideset_bits + (1 if program.sideset_opt else 0)
+    delay_bits = 5 - total
+    check_range(delay, 0, (1 << delay_bits) - 1, "delay", where)
+    value = delay
+    if side is None:
+        if program.sideset_bits and not program.sideset_opt:
+            raise PioError(f"{where}: side-set is not optional in this program")
+        return value
+    if not program.sideset_bits:
+        raise PioError(f"{where}: side-set used without .side_set")
+    check_range(side, 0, (1 << program.sideset_bits) - 1, "side-set value", where)
+    value |= side << delay_bits
+    if program.sideset_opt:
+        value |= 1 << 4
+    return value
+
+
+def encode(program: Program, text: str, where: str) -> int:
+    symbols = dict(program.defines)
+    symbols.update(program.labels)
+
+    if text.startswith(".word"):
+        return check_range(evaluate(text[5:], symbols, where), 0, 0xFFFF, ".word", where)
+
+    # Trailing "side N" and "[delay]" in either order
+    side = None
+    delay = 0
+    m = re.search(r"\[([^\]]*)\]\s*$", text)
+    if m:
+        delay = evaluate(m.group(1), symbols, where)
+        text = text[:m.start()].strip()
+    m = re.search(r"\b(?:side|sideset)\s+([^\[\]]+)$", text)
+    if m:
+        side = evaluate(m.group(1), symbols, where)
+        text = text[:m.start()].strip()
+    m = re.search(r"\[([^\]]*)\]\s*$", text)
+    if m:
+        delay = evaluate(m.group(1), symbols, where)
+        text = text[:m.start()].strip()
+
+    parts = text.split(None, 1)
+    op = parts[0].lower()
+    rest = parts[1] if len(parts) > 1 else ""
+    ds = delay_side_field(program, side, delay, where) << 8
+
+    def lookup(table: dict[str, int], name: str, what: str) -> int:
+        key = name.strip().lower()
+        if key not in table:
+            raise PioError(f"{where}: bad {what} '{name.strip()}'")
+        return table[key]
+
+    def bit_count(expr: str) -> int:
+        n = check_range(evaluate(expr, symbols, where), 1, 32, "bit count", where)
+        return n & 31
+
+    def irq_index(ops: list[str]) -> int:
+        ops = [o for o in " ".join(ops).split()]
+        rel = "rel" in [o.lower() for o in ops]
+        ops = [o for o in ops if o.lower() != "rel"]
+        if len(ops) != 1:
+            raise PioError(f"{where}: bad irq number")
+        n = check_range(evaluate(ops[0], symbols, where), 0, 7, "irq number", where)
+        return n | (0x10 if rel else 0)
+
+    if op == "nop":
+        if rest:
+            raise PioError(f"{where}: nop takes no operands")
+        return 0xA042 | ds  # mov y, y
+
+    if op == "jmp":
+        ops = split_operands(rest)
+        cond = ""
+        if len(ops) == 2:
+            cond = ops[0].lower().replace(" ", "")
+            target = ops[1]
+        elif len(ops) == 1:
+            tokens = ops[0].split()
+            if len(tokens) == 2:
+                cond, target = tokens[0].lower(), tokens[1]
+            else:
+                target = ops[0]
+        else:
+            raise PioError(f"{where}: jmp needs a target")
+        if cond not in JMP_CONDITIONS:
+            raise PioError(f"{where}: bad jmp condition '{cond}'")
+        # Relative to the program start; the kernel relocates on load
+        addr = check_range(evaluate(target, symbols, where), 0, len(program.body) - 1, "jmp target", where)
+        return 0x0000 | ds | (JMP_CONDITIONS[cond] << 5) | addr
+
+    if op == "wait":
+        tokens = rest.replace(",", " ").split()
+        if len(tokens) < 3:
+            raise PioError(f"{where}: wait needs polarity, source and index")
+        polarity = check_range(evaluate(tokens[0], symbols, where), 0, 1, "wait polarity", where)
+        source = lookup(WAIT_SOURCES, tokens[1], "wait source")
+        if source == WAIT_SOURCES["irq"]:
+            index = irq_index(tokens[2:])
+        else:
+            if len(tokens) != 3:
+                raise PioError(f"{where}: bad wait operands")
+            index = check_range(evaluate(tokens[2], symbols, where), 0, 31, "wait index", where)
+        return 0x2000 | ds | (polarity << 7) | (source << 5) | index
+
+    if op in ("in", "out"):
+        ops = split_operands(rest)
+        if len(ops) != 2:
+            raise PioError(f"{where}: {op} needs a {'source' if op == 'in' else 'destination'} and a bit count")
+        table = IN_SOURCES if op == "in" else OUT_DESTS
+        base = 0x4000 if op == "in" else 0x6000
+        return base | ds | (lookup(table, ops[0], f"{op} operand") << 5) | bit_count(ops[1])
+
+    if op in ("push", "pull"):
+        flags = [t.lower() for t in rest.split()]
+        block = 1
+        cond = 0
+        for flag in flags:
+            if flag == "block":
+                block = 1
+            elif flag == "noblock":
+                block = 0
+            elif (op == "push" and flag == "iffull") or (op == "pull" and flag == "ifempty"):
+                cond = 1
+            else:
+                raise PioError(f"{where}: bad {op} option '{flag}'")
+        return 0x8000 | ds | (0x80 if op == "pull" else 0) | (cond << 6) | (block << 5)
+
+    if op == "mov":
+        ops = split_operands(rest)
+        if len(ops) != 2:
+            raise PioError(f"{where}: mov needs a destination and a source")
+        src = ops[1].replace(" ", "")
+        operation = 0
+        if src.startswith("!") or src.startswith("~"):
+            operation, src = 1, src[1:]
+        elif src.startswith("::"):
+            operation, src = 2, src[2:]
+        return 0xA000 | ds | (lookup(MOV_DESTS, ops[0], "mov destination") << 5) | \
+            (operation << 3) | lookup(MOV_SOURCES, src, "mov source")
+
+    if op == "irq":
+        tokens = rest.replace(",", " ").split()
+        clear = wait = 0
+        if tokens and tokens[0].lower() in ("set", "nowait", "wait", "clear"):
+            mode = tokens.pop(0).lower()
+            wait = 1 if mode == "wait" else 0
+            clear = 1 if mode == "clear" else 0
+        return 0xC000 | ds | (clear << 6) | (wait << 5) | irq_index(tokens)
+
+    if op == "set":
+        ops = split_operands(rest)
+        if len(ops) != 2:
+            raise PioError(f"{where}: set needs a destination and a value")
+        value = check_range(evaluate(ops[1], symbols, where), 0, 31, "set value", where)
+        return 0xE000 | ds | (lookup(SET_DESTS, ops[0], "set destination") << 5) | value
+
+    raise PioError(f"{where}: unknown instruction '{op}'")
+
+
+def assemble(program: Program) -> None:
+    where = f"{program.source}:{program.line}"
+    if not program.body:
+        raise PioError(f"{where}: program '{program.name}' is empty")
+    if len(program.body) > MAX_INSTRUCTIONS:
+        raise PioError(f"{where}: program '{program.name}' has {len(program.body)} instructions "
+                       f"(max {MAX_INSTRUCTIONS})")
+    if program.origin >= 0 and program.origin + len(program.body) > MAX_INSTRUCTIONS:
+        raise PioError(f"{where}: program '{program.name}' does not fit at .origin {program.origin}")
+    if program.wrap_target is None:
+        program.wrap_target = 0
+    if program.wrap is None:
+        program.wrap = len(program.body) - 1
+    if program.wrap_target > program.wrap:
+        raise PioError(f"{where}: .wrap_target after .wrap in '{program.name}'")
+    for line, text in program.body:
+        program.code.append((encode(program, text, f"{program.source}:{line.number}"), text))
+
+
+def render(programs: list[Program], sources: list[str]) -> str:
+    out = [
+        "// Generated by tools/pio_asm.py from app/pio/*.pio - do not edit",
+        "#pragma once",
+        "",
+        '#include "pio_program.h"',
+        "",
+    ]
+    for program in programs:
+        name = program.name
+        out.append(f"// {os.path.basename(program.source)}: {name}")
+        # The kernel reads both objects as data in Pio_load, so they must not
+        # sit in an overlay page that may not be loaded
+        out.append(f"static APP_RESIDENT_CONST const uint16_t {name}_program_instructions[] = {{")
+        for i, (word, text) in enumerate(program.code):
+            marks = []
+            if i == program.wrap_target:
+                marks.append(".wrap_target")
+            if i == program.wrap:
+                marks.append(".wrap")
+            suffix = f"  {' '.join(marks)}" if marks else ""
+            out.append(f"    0x{word:04x},  // {i:2d}: {text}{suffix}")
+        out.append("};")
+        sideset_flags = (1 if program.sideset_opt else 0) | (2 if program.sideset_pindirs else 0)
+        out.append(f"static APP_RESIDENT_CONST const PioProgram {name}_program = {{")
+        out.append(f"    {name}_program_instructions, {len(program.code)}, {program.origin}, "
+                   f"{program.wrap_target}, {program.wrap}, {program.sideset_bits}, {sideset_flags}, 0")
+        out.append("};")
+        for label in program.public:
+            out.append(f"#define {name}_offset_{label} {program.labels[label]}u")
+        for define in program.public_defines:
+            out.append(f"#define {name}_{define} {program.defines[define]}")
+        out.append("")
+    if not sources:
+        out.append("// No .pio sources")
+        out.append("")
+    return "\n".join(out)
+
+
+def main() -> int:
+    if len(sys.argv) != 3:
+        print("Usage: pio_asm.py <pio source dir> <pio_programs.h>", file=sys.stderr)
+        return 1
+
+    src_dir, out_path = sys.argv[1], sys.argv[2]
+    sources = sorted(os.path.join(src_dir, f) for f in os.listdir(src_dir)
+                     if f.endswith(".pio")) if os.path.isdir(src_dir) else []
+
+    programs: list[Program] = []
+    try:
+        for path in sources:
+            programs.extend(parse_file(path))
+        names = [p.name for p in programs]
+        for name in names:
+            if names.count(name) > 1:
+                raise PioError(f"program '{name}' is defined more than once")
+    except (OSError, PioError) as e:
+        print(f"Error: {e}", file=sys.stderr)
+        return 1
+
+    header = render(programs, sources)
+    try:
+        with open(out_path, "r", encoding="utf-8") as f:
+            unchanged = f.read() == header
+    except OSError:
+        unchanged = False
+    if not unchanged:
+        # Only rewrite on change, so the app is not rebuilt needlessly
+        with open(out_path, "w", encoding="utf-8") as f:
+            f.write(header)
+
+    print(f"Assembled {len(programs)} PIO program(s) into {out_path}", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
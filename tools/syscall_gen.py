@@ -140,6 +140,9 @@ prefix_map = {
         "safe_wrappers": {
             "print_s": "syscall_safe_wrappers::serialPrintSafe",
             "println_s": "syscall_safe_wrappers::serialPrintlnSafe",
+            "writeBuf": "syscall_safe_wrappers::serialWriteBufSafe",
+            "readBuf": "syscall_safe_wrappers::serialReadBuf",
+            "readUntil": "syscall_safe_wrappers::serialReadUntil",
         },
         "method_casts": {
             # Map syscall method name to full cast expression
@@ -152,20 +155,36 @@ prefix_map = {
     "SPI_": {
         "obj": "SPI",
         "safe_wrappers": {
-            # beginTransaction needs default SPISettings wrapper
+            # beginTransaction rebuilds SPISettings from plain values
             "beginTransaction": "syscall_safe_wrappers::spiBeginTransaction",
+            # Everything that touches the bus waits for a pending DMA transfer first
+            "endTransaction": "syscall_safe_wrappers::spiEndTransaction",
+            "transfer": "syscall_safe_wrappers::spiTransfer",
+            "transferBuf": "syscall_safe_wrappers::spiTransferBuf",
+            "writeBuf": "syscall_safe_wrappers::spiWriteBuf",
+            "transferAsync": "syscall_safe_wrappers::spiTransferAsync",
+            "asyncDone": "syscall_safe_wrappers::spiAsyncDone",
         }
     },
     "Wire_": {
         "obj": "Wire",
-        "method_names": {
-            # Map syscall method names to actual method names
-            "write_b": "write",  # Wire::write(uint8_t)
-            "write_buf": "write",  # Wire::write(const uint8_t*, size_t)
-        },
-        "method_casts": {
-            # requestFrom returns size_t and takes (uint8_t, size_t)
-            "requestFrom": "static_cast<size_t (TwoWire::*)(uint8_t, size_t)>(&TwoWire::requestFrom)",
+        "safe_wrappers": {
+            # begin also sets up the async worker; byte-wise calls stage
+            # their bytes per task and only take the bus mutex inside
+            # endTransmission and requestFrom
+            "begin": "syscall_safe_wrappers::wireBegin",
+            "end": "syscall_safe_wrappers::wireEnd",
+            "beginTransmission": "syscall_safe_wrappers::wireBeginTransmission",
+            "endTransmission": "syscall_safe_wrappers::wireEndTransmission",
+            "requestFrom": "syscall_safe_wrappers::wireRequestFrom",
+            "write_b": "syscall_safe_wrappers::wireWriteByte",
+            "write_buf": "syscall_safe_wrappers::wireWriteBuf",
+            "available": "syscall_safe_wrappers::wireAvailable",
+            "read": "syscall_safe_wrappers::wireRead",
+            "readBuf": "syscall_safe_wrappers::wireReadBuf",
+            "writeReg": "syscall_safe_wrappers::wireWriteReg",
+            "readBufAsync": "syscall_safe_wrappers::wireReadBufAsync",
+            "writeRegAsync": "syscall_safe_wrappers::wireWriteRegAsync",
         }
     },
     "multicore_": {
@@ -180,6 +199,114 @@ prefix_map = {
             "fifo_wready": "multicore_fifo_wready",
         }
     },
+    "gpio_": {
+        # Port-wide GPIO - wrappers enforce the app's pin claims
+        "free_functions": {
+            "claim": "syscall_safe_wrappers::gpioClaim",
+            "release": "syscall_safe_wrappers::gpioRelease",
+            "claimed": "syscall_safe_wrappers::gpioClaimed",
+            "put_masked": "syscall_safe_wrappers::gpioPutMasked",
+            "set_dir_masked": "syscall_safe_wrappers::gpioSetDirMasked",
+            "get_all": "syscall_safe_wrappers::gpioGetAll",
+        }
+    },
+    "App_": {
+        # loop() scheduling lives in kernel/src/app_scheduler.cpp (not an object)
+        "free_functions": {
+            "setLoopMode": "::app_scheduler_set_mode",
+            "loopWake": "::app_scheduler_wake",
+            "getLoopStats": "::app_scheduler_get_stats",
+            "resetLoopStats": "::app_scheduler_reset_stats",
+        }
+    },
+    "Cache_": {
+        # Code overlay cache - wrappers map addresses to pages
+        "free_functions": {
+            "pin": "syscall_safe_wrappers::cachePin",
+            "unpin": "syscall_safe_wrappers::cacheUnpin",
+            "setPartition": "syscall_safe_wrappers::cacheSetPartition",
+            "getStats": "syscall_safe_wrappers::cacheGetStats",
+        }
+    },
+    "Task_": {
+        # App tasks, queues and event groups live in kernel/src/app_tasks.cpp (not objects)
+        "free_functions": {
+            "create": "::app_task_create",
+            "delete": "::app_task_delete",
+            "notifyGive": "::app_task_notify_give",
+            "notifyTake": "::app_task_notify_take",
+        }
+    },
+    "Queue_": {
+        "free_functions": {
+            "create": "::app_queue_create",
+            "delete": "::app_queue_delete",
+            "send": "::app_queue_send",
+            "receive": "::app_queue_receive",
+            "count": "::app_queue_count",
+        }
+    },
+    "Event_": {
+        "free_functions": {
+            "create": "::app_event_create",
+            "delete": "::app_event_delete",
+            "set": "::app_event_set",
+            "clear": "::app_event_clear",
+            "wait": "::app_event_wait",
+        }
+    },
+    "Timer_": {
+        # Hardware alarm timers live in kernel/src/app_timer.cpp (not an object)
+        "free_functions": {
+            "startRepeating": "::app_timer_start_repeating",
+            "startOnce": "::app_timer_start_once",
+            "stop": "::app_timer_stop",
+            "getStats": "::app_timer_get_stats",
+        }
+    },
+    "Defer_": {
+        # Deferred interrupt work lives in kernel/src/app_defer.cpp (not an object)
+        "free_functions": {
+            "post": "::app_defer_post",
+            "getStats": "::app_defer_get_stats",
+            "resetStats": "::app_defer_reset_stats",
+        }
+    },
+    "EdgeCapture_": {
+        # GPIO edge capture lives in kernel/src/edge_capture.cpp (not an object)
+        "free_functions": {
+            "start": "::edge_capture_start",
+            "stop": "::edge_capture_stop",
+            "read": "::edge_capture_read",
+            "overruns": "::edge_capture_overruns",
+            "clockHz": "::edge_capture_clock_hz",
+        }
+    },
+    "Pio_": {
+        # PIO programs and state machines live in kernel/src/app_pio.cpp (not an object)
+        "free_functions": {
+            "load": "::app_pio_load",
+            "unload": "::app_pio_unload",
+            "smInit": "::app_pio_sm_init",
+            "smRelease": "::app_pio_sm_release",
+            "smEnable": "::app_pio_sm_enable",
+            "smExec": "::app_pio_sm_exec",
+            "put": "::app_pio_put",
+            "get": "::app_pio_get",
+            "dmaPut": "::app_pio_dma_put",
+            "dmaGet": "::app_pio_dma_get",
+            "dmaBusy": "::app_pio_dma_busy",
+        }
+    },
+    "ADC_": {
+        # ADC streaming lives in kernel/src/adc_stream.cpp (not an object)
+        "free_functions": {
+            "startStream": "::adc_stream_start",
+            "stopStream": "::adc_stream_stop",
+            "streamPoll": "::adc_stream_poll",
+            "streamOverruns": "::adc_stream_overruns",
+        }
+    },
     "WiFi_": {
         "obj": "WiFi",
         "safe_wrappers": {
@@ -219,6 +346,7 @@ prefix_map = {
         "free_functions": {
             "attachInterrupt": "::KernelAttachInterrupt",
             "detachInterrupt": "::KernelDetachInterrupt",
+            "attachInterruptDeferred": "::KernelAttachInterruptDeferred",
         }
     }
 }
@@ -226,7 +354,7 @@ prefix_map = {
 # First pass: detect objects from syscall names
 # We auto-detect all objects; overrides are handled in dispatch phase
 # Exclude prefixes that are NOT objects (like namespace prefixes)
-non_object_prefixes = {"multicore", "BLE"}  # These are prefixes, not object names
+non_object_prefixes = {"multicore", "BLE", "gpio", "ADC", "Timer", "App", "Task", "Queue", "Event", "Cache", "Defer", "EdgeCapture", "Pio"}  # These are prefixes, not object names
 # Note: WiFi is an object, BLE is not (it's a namespace of free functions)
 
 for n, ret, args, annot_type, annot_obj, annot_method in syscalls: